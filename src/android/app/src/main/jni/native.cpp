@@ -3,6 +3,7 @@
 
 #include <codecvt>
 #include <locale>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <dlfcn.h>
@@ -335,8 +336,9 @@ void EmulationSession::RunEmulation() {
         m_is_running = true;
     }
 
-    // Load the disk shader cache.
-    if (Settings::values.use_disk_shader_cache.GetValue()) {
+    // Load the disk shader and texture caches.
+    if (Settings::values.use_disk_shader_cache.GetValue() ||
+        Settings::values.use_disk_texture_cache.GetValue()) {
         LoadDiskCacheProgress(VideoCore::LoadCallbackStage::Prepare, 0, 0);
         m_system.Renderer().ReadRasterizer()->LoadDiskResources(
             m_system.GetApplicationProcessProgramID(), std::stop_token{}, LoadDiskCacheProgress);
@@ -458,11 +460,29 @@ int Java_org_citron_citron_1emu_NativeLibrary_installFileToNand(JNIEnv* env, job
     auto jlambdaClass = env->GetObjectClass(jcallback);
     auto jlambdaInvokeMethod = env->GetMethodID(
         jlambdaClass, "invoke", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
-    const auto callback = [env, jcallback, jlambdaInvokeMethod](size_t max, size_t progress) {
-        auto jwasCancelled = env->CallObjectMethod(jcallback, jlambdaInvokeMethod,
-                                                   Common::Android::ToJDouble(env, max),
-                                                   Common::Android::ToJDouble(env, progress));
-        return Common::Android::GetJBoolean(env, jwasCancelled);
+
+    // The NCAs of a package are copied on several worker threads, so the callback can't use the
+    // env or the local reference of this thread.
+    jobject jglobal_callback = env->NewGlobalRef(jcallback);
+    SCOPE_EXIT {
+        env->DeleteGlobalRef(jglobal_callback);
+    };
+    std::mutex callback_mutex;
+    const auto callback = [&callback_mutex, jglobal_callback,
+                           jlambdaInvokeMethod](size_t max, size_t progress) {
+        std::scoped_lock lock{callback_mutex};
+        JNIEnv* thread_env = Common::Android::GetEnvForThread();
+        jobject jmax = Common::Android::ToJDouble(thread_env, max);
+        jobject jprogress = Common::Android::ToJDouble(thread_env, progress);
+        auto jwasCancelled =
+            thread_env->CallObjectMethod(jglobal_callback, jlambdaInvokeMethod, jmax, jprogress);
+        const bool was_cancelled = Common::Android::GetJBoolean(thread_env, jwasCancelled);
+
+        // Worker threads never return to Java, so their local references have to be freed here.
+        thread_env->DeleteLocalRef(jmax);
+        thread_env->DeleteLocalRef(jprogress);
+        thread_env->DeleteLocalRef(jwasCancelled);
+        return was_cancelled;
     };
 
     return static_cast<int>(
@@ -784,11 +804,29 @@ jobjectArray Java_org_citron_citron_1emu_NativeLibrary_verifyInstalledContents(J
     auto jlambdaClass = env->GetObjectClass(jcallback);
     auto jlambdaInvokeMethod = env->GetMethodID(
         jlambdaClass, "invoke", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
-    const auto callback = [env, jcallback, jlambdaInvokeMethod](size_t max, size_t progress) {
-        auto jwasCancelled = env->CallObjectMethod(jcallback, jlambdaInvokeMethod,
-                                                   Common::Android::ToJDouble(env, max),
-                                                   Common::Android::ToJDouble(env, progress));
-        return Common::Android::GetJBoolean(env, jwasCancelled);
+
+    // The NCAs of a package are copied on several worker threads, so the callback can't use the
+    // env or the local reference of this thread.
+    jobject jglobal_callback = env->NewGlobalRef(jcallback);
+    SCOPE_EXIT {
+        env->DeleteGlobalRef(jglobal_callback);
+    };
+    std::mutex callback_mutex;
+    const auto callback = [&callback_mutex, jglobal_callback,
+                           jlambdaInvokeMethod](size_t max, size_t progress) {
+        std::scoped_lock lock{callback_mutex};
+        JNIEnv* thread_env = Common::Android::GetEnvForThread();
+        jobject jmax = Common::Android::ToJDouble(thread_env, max);
+        jobject jprogress = Common::Android::ToJDouble(thread_env, progress);
+        auto jwasCancelled =
+            thread_env->CallObjectMethod(jglobal_callback, jlambdaInvokeMethod, jmax, jprogress);
+        const bool was_cancelled = Common::Android::GetJBoolean(thread_env, jwasCancelled);
+
+        // Worker threads never return to Java, so their local references have to be freed here.
+        thread_env->DeleteLocalRef(jmax);
+        thread_env->DeleteLocalRef(jprogress);
+        thread_env->DeleteLocalRef(jwasCancelled);
+        return was_cancelled;
     };
 
     auto& session = EmulationSession::GetInstance();
@@ -807,11 +845,29 @@ jint Java_org_citron_citron_1emu_NativeLibrary_verifyGameContents(JNIEnv* env, j
     auto jlambdaClass = env->GetObjectClass(jcallback);
     auto jlambdaInvokeMethod = env->GetMethodID(
         jlambdaClass, "invoke", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
-    const auto callback = [env, jcallback, jlambdaInvokeMethod](size_t max, size_t progress) {
-        auto jwasCancelled = env->CallObjectMethod(jcallback, jlambdaInvokeMethod,
-                                                   Common::Android::ToJDouble(env, max),
-                                                   Common::Android::ToJDouble(env, progress));
-        return Common::Android::GetJBoolean(env, jwasCancelled);
+
+    // The NCAs of a package are copied on several worker threads, so the callback can't use the
+    // env or the local reference of this thread.
+    jobject jglobal_callback = env->NewGlobalRef(jcallback);
+    SCOPE_EXIT {
+        env->DeleteGlobalRef(jglobal_callback);
+    };
+    std::mutex callback_mutex;
+    const auto callback = [&callback_mutex, jglobal_callback,
+                           jlambdaInvokeMethod](size_t max, size_t progress) {
+        std::scoped_lock lock{callback_mutex};
+        JNIEnv* thread_env = Common::Android::GetEnvForThread();
+        jobject jmax = Common::Android::ToJDouble(thread_env, max);
+        jobject jprogress = Common::Android::ToJDouble(thread_env, progress);
+        auto jwasCancelled =
+            thread_env->CallObjectMethod(jglobal_callback, jlambdaInvokeMethod, jmax, jprogress);
+        const bool was_cancelled = Common::Android::GetJBoolean(thread_env, jwasCancelled);
+
+        // Worker threads never return to Java, so their local references have to be freed here.
+        thread_env->DeleteLocalRef(jmax);
+        thread_env->DeleteLocalRef(jprogress);
+        thread_env->DeleteLocalRef(jwasCancelled);
+        return was_cancelled;
     };
     auto& session = EmulationSession::GetInstance();
     return static_cast<jint>(ContentManager::VerifyGameContents(
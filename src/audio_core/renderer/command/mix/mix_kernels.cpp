@@ -0,0 +1,244 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <limits>
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+
+#if defined(ARCHITECTURE_x86_64) && !defined(_MSC_VER)
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_SSE41
+#define TARGET_AVX2
+#endif
+
+namespace AudioCore::Renderer::MixKernels {
+
+namespace {
+
+using Kernel = void (*)(s32* output, const s32* input, size_t count, s64 volume, s64 ramp,
+                        u32 precision);
+
+/// Matches Common::FixedPoint::to_int, which rounds up when the fraction is at least 2/3.
+constexpr s32 ToSample(s64 value, u32 precision) {
+    const s64 fraction_mask{(s64{1} << precision) - 1};
+    value += (value & fraction_mask) >> 1;
+    return static_cast<s32>(value >> precision);
+}
+
+template <bool Accumulate>
+void KernelScalar(s32* output, const s32* input, size_t count, s64 volume, s64 ramp,
+                  u32 precision) {
+    for (size_t i = 0; i < count; i++) {
+        s64 value{s64{input[i]} * volume};
+        if constexpr (Accumulate) {
+            value += s64{output[i]} * (s64{1} << precision);
+        }
+        output[i] = ToSample(value, precision);
+        volume += ramp;
+    }
+}
+
+/// The vector kernels multiply 32-bit samples by 32-bit volumes into 64-bit products, so every
+/// volume along the ramp has to fit in 32 bits.
+bool FitsVectorKernel(size_t count, s64 volume, s64 ramp, u32 precision) {
+    constexpr s64 min{std::numeric_limits<s32>::min()};
+    constexpr s64 max{std::numeric_limits<s32>::max()};
+    if (count == 0 || precision >= 31 || ramp < min || ramp > max) {
+        return false;
+    }
+    const s64 last_volume{volume + ramp * static_cast<s64>(count - 1)};
+    return volume >= min && volume <= max && last_volume >= min && last_volume <= max;
+}
+
+template <size_t Lanes>
+std::array<s32, Lanes> RampVolumes(s64 volume, s64 ramp) {
+    std::array<s32, Lanes> volumes;
+    for (size_t i = 0; i < Lanes; i++) {
+        volumes[i] = static_cast<s32>(volume + ramp * static_cast<s64>(i));
+    }
+    return volumes;
+}
+
+#if defined(ARCHITECTURE_x86_64)
+
+TARGET_SSE41 __m128i ToSamplesSSE41(__m128i values, __m128i fraction_mask, __m128i shift) {
+    const __m128i fraction{_mm_and_si128(values, fraction_mask)};
+    values = _mm_add_epi64(values, _mm_srli_epi64(fraction, 1));
+    // Only the low 32 bits of each lane are kept, so a logical shift is enough
+    return _mm_srl_epi64(values, shift);
+}
+
+template <bool Accumulate>
+TARGET_SSE41 void KernelSSE41(s32* output, const s32* input, size_t count, s64 volume, s64 ramp,
+                              u32 precision) {
+    const __m128i shift{_mm_cvtsi32_si128(static_cast<int>(precision))};
+    const __m128i fraction_mask{_mm_set1_epi64x((s64{1} << precision) - 1)};
+    const __m128i unit{_mm_set1_epi32(1 << precision)};
+    const __m128i volume_step{_mm_set1_epi32(static_cast<s32>(ramp * 4))};
+    const auto initial_volumes{RampVolumes<4>(volume, ramp)};
+    __m128i volumes{_mm_loadu_si128(reinterpret_cast<const __m128i*>(initial_volumes.data()))};
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i samples{_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i))};
+        __m128i even{_mm_mul_epi32(samples, volumes)};
+        __m128i odd{_mm_mul_epi32(_mm_srli_epi64(samples, 32), _mm_srli_epi64(volumes, 32))};
+        if constexpr (Accumulate) {
+            const __m128i mixed{_mm_loadu_si128(reinterpret_cast<const __m128i*>(output + i))};
+            even = _mm_add_epi64(even, _mm_mul_epi32(mixed, unit));
+            odd = _mm_add_epi64(odd, _mm_mul_epi32(_mm_srli_epi64(mixed, 32), unit));
+        }
+        even = ToSamplesSSE41(even, fraction_mask, shift);
+        odd = ToSamplesSSE41(odd, fraction_mask, shift);
+        const __m128i result{_mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC)};
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), result);
+        volumes = _mm_add_epi32(volumes, volume_step);
+    }
+    KernelScalar<Accumulate>(output + i, input + i, count - i,
+                             volume + ramp * static_cast<s64>(i), ramp, precision);
+}
+
+TARGET_AVX2 __m256i ToSamplesAVX2(__m256i values, __m256i fraction_mask, __m128i shift) {
+    const __m256i fraction{_mm256_and_si256(values, fraction_mask)};
+    values = _mm256_add_epi64(values, _mm256_srli_epi64(fraction, 1));
+    return _mm256_srl_epi64(values, shift);
+}
+
+template <bool Accumulate>
+TARGET_AVX2 void KernelAVX2(s32* output, const s32* input, size_t count, s64 volume, s64 ramp,
+                            u32 precision) {
+    const __m128i shift{_mm_cvtsi32_si128(static_cast<int>(precision))};
+    const __m256i fraction_mask{_mm256_set1_epi64x((s64{1} << precision) - 1)};
+    const __m256i unit{_mm256_set1_epi32(1 << precision)};
+    const __m256i volume_step{_mm256_set1_epi32(static_cast<s32>(ramp * 8))};
+    const auto initial_volumes{RampVolumes<8>(volume, ramp)};
+    __m256i volumes{
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(initial_volumes.data()))};
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256i samples{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i))};
+        __m256i even{_mm256_mul_epi32(samples, volumes)};
+        __m256i odd{
+            _mm256_mul_epi32(_mm256_srli_epi64(samples, 32), _mm256_srli_epi64(volumes, 32))};
+        if constexpr (Accumulate) {
+            const __m256i mixed{
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(output + i))};
+            even = _mm256_add_epi64(even, _mm256_mul_epi32(mixed, unit));
+            odd = _mm256_add_epi64(odd, _mm256_mul_epi32(_mm256_srli_epi64(mixed, 32), unit));
+        }
+        even = ToSamplesAVX2(even, fraction_mask, shift);
+        odd = ToSamplesAVX2(odd, fraction_mask, shift);
+        const __m256i result{_mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA)};
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), result);
+        volumes = _mm256_add_epi32(volumes, volume_step);
+    }
+    KernelScalar<Accumulate>(output + i, input + i, count - i,
+                             volume + ramp * static_cast<s64>(i), ramp, precision);
+}
+
+#elif defined(ARCHITECTURE_arm64)
+
+int64x2_t ToSamplesNEON(int64x2_t values, int64x2_t fraction_mask, int64x2_t shift) {
+    const int64x2_t fraction{vandq_s64(values, fraction_mask)};
+    values = vaddq_s64(values, vshrq_n_s64(fraction, 1));
+    return vshlq_s64(values, shift);
+}
+
+template <bool Accumulate>
+void KernelNEON(s32* output, const s32* input, size_t count, s64 volume, s64 ramp,
+                u32 precision) {
+    const int64x2_t shift{vdupq_n_s64(-static_cast<s64>(precision))};
+    const int64x2_t fraction_mask{vdupq_n_s64((s64{1} << precision) - 1)};
+    const int32x4_t unit{vdupq_n_s32(1 << precision)};
+    const int32x4_t volume_step{vdupq_n_s32(static_cast<s32>(ramp * 4))};
+    const auto initial_volumes{RampVolumes<4>(volume, ramp)};
+    int32x4_t volumes{vld1q_s32(initial_volumes.data())};
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const int32x4_t samples{vld1q_s32(input + i)};
+        int64x2_t low{vmull_s32(vget_low_s32(samples), vget_low_s32(volumes))};
+        int64x2_t high{vmull_high_s32(samples, volumes)};
+        if constexpr (Accumulate) {
+            const int32x4_t mixed{vld1q_s32(output + i)};
+            low = vmlal_s32(low, vget_low_s32(mixed), vget_low_s32(unit));
+            high = vmlal_high_s32(high, mixed, unit);
+        }
+        low = ToSamplesNEON(low, fraction_mask, shift);
+        high = ToSamplesNEON(high, fraction_mask, shift);
+        vst1q_s32(output + i, vcombine_s32(vmovn_s64(low), vmovn_s64(high)));
+        volumes = vaddq_s32(volumes, volume_step);
+    }
+    KernelScalar<Accumulate>(output + i, input + i, count - i,
+                             volume + ramp * static_cast<s64>(i), ramp, precision);
+}
+
+#endif
+
+struct Kernels {
+    Kernel mix;
+    Kernel gain;
+};
+
+Kernels SelectKernels() {
+#if defined(ARCHITECTURE_x86_64)
+    const auto& caps{Common::GetCPUCaps()};
+    if (caps.avx2) {
+        return {KernelAVX2<true>, KernelAVX2<false>};
+    }
+    if (caps.sse4_1) {
+        return {KernelSSE41<true>, KernelSSE41<false>};
+    }
+#elif defined(ARCHITECTURE_arm64)
+    return {KernelNEON<true>, KernelNEON<false>};
+#endif
+    return {KernelScalar<true>, KernelScalar<false>};
+}
+
+const Kernels& GetKernels() {
+    static const Kernels kernels{SelectKernels()};
+    return kernels;
+}
+
+} // Anonymous namespace
+
+void MixRamp(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+             u32 precision) {
+    if (!FitsVectorKernel(output.size(), volume, ramp, precision)) {
+        MixRampScalar(output, input, volume, ramp, precision);
+        return;
+    }
+    GetKernels().mix(output.data(), input.data(), output.size(), volume, ramp, precision);
+}
+
+void ApplyGainRamp(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+                   u32 precision) {
+    if (!FitsVectorKernel(output.size(), volume, ramp, precision)) {
+        ApplyGainRampScalar(output, input, volume, ramp, precision);
+        return;
+    }
+    GetKernels().gain(output.data(), input.data(), output.size(), volume, ramp, precision);
+}
+
+void MixRampScalar(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+                   u32 precision) {
+    KernelScalar<true>(output.data(), input.data(), output.size(), volume, ramp, precision);
+}
+
+void ApplyGainRampScalar(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+                         u32 precision) {
+    KernelScalar<false>(output.data(), input.data(), output.size(), volume, ramp, precision);
+}
+
+} // namespace AudioCore::Renderer::MixKernels
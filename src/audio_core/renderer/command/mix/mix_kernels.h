@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "common/common_types.h"
+
+namespace AudioCore::Renderer {
+
+/**
+ * Sample kernels shared by the mix and volume commands.
+ *
+ * Volumes are passed as raw Common::FixedPoint<64 - Q, Q> values, and every output sample is
+ * rounded exactly like Common::FixedPoint::to_int, so the results match the scalar fixed point
+ * loops bit for bit. SSE4.1 or AVX2 is selected at runtime on x86-64, and NEON is always used
+ * on arm64. Volumes that do not fit in 32 bits fall back to the scalar loop.
+ */
+namespace MixKernels {
+
+/**
+ * Mix the input into the output with a ramping volume.
+ * output[i] += input[i] * (volume + ramp * i)
+ *
+ * @param output    - Output samples.
+ * @param input     - Input samples, at least as many as the output.
+ * @param volume    - Raw fixed point volume of the first sample.
+ * @param ramp      - Raw fixed point volume increment per sample.
+ * @param precision - Number of fractional bits of the fixed point values.
+ */
+void MixRamp(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+             u32 precision);
+
+/**
+ * Apply a ramping volume to the input, saving to the output.
+ * output[i] = input[i] * (volume + ramp * i)
+ *
+ * @param output    - Output samples.
+ * @param input     - Input samples, at least as many as the output.
+ * @param volume    - Raw fixed point volume of the first sample.
+ * @param ramp      - Raw fixed point volume increment per sample.
+ * @param precision - Number of fractional bits of the fixed point values.
+ */
+void ApplyGainRamp(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+                   u32 precision);
+
+/**
+ * Scalar reference implementations of the kernels above, used for testing.
+ */
+void MixRampScalar(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+                   u32 precision);
+void ApplyGainRampScalar(std::span<s32> output, std::span<const s32> input, s64 volume, s64 ramp,
+                         u32 precision);
+
+} // namespace MixKernels
+
+} // namespace AudioCore::Renderer
@@ -1,10 +1,157 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
 #include "audio_core/renderer/command/resample/resample.h"
 
+#if defined(ARCHITECTURE_x86_64) && !defined(_MSC_VER)
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+#else
+#define TARGET_SSE41
+#endif
+
 namespace AudioCore::Renderer {
 
+/// Number of output samples filtered together by the vector paths.
+constexpr size_t FilterBatchSize = 4;
+
+using FilterWindows = std::array<const s16*, FilterBatchSize>;
+using FilterCoefficients = std::array<const f32*, FilterBatchSize>;
+using FilterBatch = void (*)(s32* output, const FilterWindows& windows,
+                             const FilterCoefficients& coefficients);
+
+/**
+ * Filter one output sample. Each tap is truncated to Common::FixedPoint<56, 8> before being
+ * accumulated, and the sum is floored.
+ */
+template <size_t Taps>
+static s32 FilterSample(const s16* window, const f32* coefficients) {
+    Common::FixedPoint<56, 8> sum{0};
+    for (size_t tap = 0; tap < Taps; tap++) {
+        sum += Common::FixedPoint<56, 8>{window[tap] * coefficients[tap]};
+    }
+    return sum.to_int_floor();
+}
+
+#if defined(ARCHITECTURE_x86_64)
+
+template <size_t Taps>
+TARGET_SSE41 static __m128i FilterRowSSE41(const s16* window, const f32* coefficients) {
+    const __m128 scale{_mm_set1_ps(256.0f)};
+    __m128i sum{_mm_setzero_si128()};
+    for (size_t tap = 0; tap < Taps; tap += 4) {
+        const __m128i samples{
+            _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(window + tap)))};
+        const __m128 products{
+            _mm_mul_ps(_mm_cvtepi32_ps(samples), _mm_loadu_ps(coefficients + tap))};
+        sum = _mm_add_epi32(sum, _mm_cvttps_epi32(_mm_mul_ps(products, scale)));
+    }
+    return sum;
+}
+
+template <size_t Taps>
+TARGET_SSE41 static void FilterBatchSSE41(s32* output, const FilterWindows& windows,
+                                          const FilterCoefficients& coefficients) {
+    const __m128i row0{FilterRowSSE41<Taps>(windows[0], coefficients[0])};
+    const __m128i row1{FilterRowSSE41<Taps>(windows[1], coefficients[1])};
+    const __m128i row2{FilterRowSSE41<Taps>(windows[2], coefficients[2])};
+    const __m128i row3{FilterRowSSE41<Taps>(windows[3], coefficients[3])};
+    const __m128i sums{_mm_hadd_epi32(_mm_hadd_epi32(row0, row1), _mm_hadd_epi32(row2, row3))};
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_srai_epi32(sums, 8));
+}
+
+#elif defined(ARCHITECTURE_arm64)
+
+template <size_t Taps>
+static int32x4_t FilterRowNEON(const s16* window, const f32* coefficients) {
+    int32x4_t sum{vdupq_n_s32(0)};
+    for (size_t tap = 0; tap < Taps; tap += 4) {
+        const float32x4_t samples{vcvtq_f32_s32(vmovl_s16(vld1_s16(window + tap)))};
+        const float32x4_t products{vmulq_f32(samples, vld1q_f32(coefficients + tap))};
+        sum = vaddq_s32(sum, vcvtq_s32_f32(vmulq_n_f32(products, 256.0f)));
+    }
+    return sum;
+}
+
+template <size_t Taps>
+static void FilterBatchNEON(s32* output, const FilterWindows& windows,
+                            const FilterCoefficients& coefficients) {
+    const int32x4_t row0{FilterRowNEON<Taps>(windows[0], coefficients[0])};
+    const int32x4_t row1{FilterRowNEON<Taps>(windows[1], coefficients[1])};
+    const int32x4_t row2{FilterRowNEON<Taps>(windows[2], coefficients[2])};
+    const int32x4_t row3{FilterRowNEON<Taps>(windows[3], coefficients[3])};
+    const int32x4_t sums{vpaddq_s32(vpaddq_s32(row0, row1), vpaddq_s32(row2, row3))};
+    vst1q_s32(output, vshrq_n_s32(sums, 8));
+}
+
+#endif
+
+template <size_t Taps>
+static FilterBatch SelectFilterBatch() {
+#if defined(ARCHITECTURE_x86_64)
+    if (Common::GetCPUCaps().sse4_1) {
+        return FilterBatchSSE41<Taps>;
+    }
+#elif defined(ARCHITECTURE_arm64)
+    return FilterBatchNEON<Taps>;
+#endif
+    return nullptr;
+}
+
+/**
+ * Run a polyphase filter over the input. The read positions and coefficient phases are stepped
+ * in order, and batches of output samples are then filtered together when a vector path exists.
+ *
+ * @tparam Taps             - Number of input samples per output sample.
+ * @param output            - Output buffer.
+ * @param input             - Input buffer.
+ * @param lut               - Filter coefficients, Taps per phase.
+ * @param sample_rate_ratio - Ratio for resampling.
+ * @param fraction          - Current read fraction.
+ * @param samples_to_write  - Number of samples to write.
+ * @param vectorize         - Whether the vector path may be used.
+ */
+template <size_t Taps>
+static void ApplyFilter(std::span<s32> output, std::span<const s16> input,
+                        std::span<const f32> lut,
+                        const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                        Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write,
+                        const bool vectorize) {
+    static const FilterBatch filter_batch{SelectFilterBatch<Taps>()};
+
+    u32 read_index{0};
+    u32 i{0};
+    if (vectorize && filter_batch) {
+        FilterWindows windows;
+        FilterCoefficients coefficients;
+        for (; i + FilterBatchSize <= samples_to_write; i += FilterBatchSize) {
+            for (size_t j = 0; j < FilterBatchSize; j++) {
+                windows[j] = input.data() + read_index;
+                coefficients[j] = lut.data() + (fraction.get_frac() >> 8) * Taps;
+                fraction += sample_rate_ratio;
+                read_index += static_cast<u32>(fraction.to_int_floor());
+                fraction.clear_int();
+            }
+            filter_batch(output.data() + i, windows, coefficients);
+        }
+    }
+    for (; i < samples_to_write; i++) {
+        const auto lut_index{(fraction.get_frac() >> 8) * Taps};
+        output[i] = FilterSample<Taps>(input.data() + read_index, lut.data() + lut_index);
+        fraction += sample_rate_ratio;
+        read_index += static_cast<u32>(fraction.to_int_floor());
+        fraction.clear_int();
+    }
+}
+
 static void ResampleLowQuality(std::span<s32> output, std::span<const s16> input,
                                const Common::FixedPoint<49, 15>& sample_rate_ratio,
                                Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write) {
@@ -26,7 +173,7 @@ static void ResampleLowQuality(std::span<s32> output, std::span<const s16> input
 static void ResampleNormalQuality(std::span<s32> output, std::span<const s16> input,
                                   const Common::FixedPoint<49, 15>& sample_rate_ratio,
                                   Common::FixedPoint<49, 15>& fraction,
-                                  const u32 samples_to_write) {
+                                  const u32 samples_to_write, const bool vectorize) {
     static constexpr std::array<f32, 512> lut0 = {
         0.20141602f, 0.59283447f, 0.20513916f, 0.00009155f, 0.19772339f, 0.59277344f, 0.20889282f,
         0.00027466f, 0.19406128f, 0.59262085f, 0.21264648f, 0.00045776f, 0.19039917f, 0.59240723f,
@@ -292,24 +439,14 @@ static void ResampleNormalQuality(std::span<s32> output, std::span<const s16> in
         }
     };
 
-    auto lut{get_lut()};
-    u32 read_index{0};
-    for (u32 i = 0; i < samples_to_write; i++) {
-        const auto lut_index{(fraction.get_frac() >> 8) * 4};
-        const Common::FixedPoint<56, 8> sample0{input[read_index + 0] * lut[lut_index + 0]};
-        const Common::FixedPoint<56, 8> sample1{input[read_index + 1] * lut[lut_index + 1]};
-        const Common::FixedPoint<56, 8> sample2{input[read_index + 2] * lut[lut_index + 2]};
-        const Common::FixedPoint<56, 8> sample3{input[read_index + 3] * lut[lut_index + 3]};
-        output[i] = (sample0 + sample1 + sample2 + sample3).to_int_floor();
-        fraction += sample_rate_ratio;
-        read_index += static_cast<u32>(fraction.to_int_floor());
-        fraction.clear_int();
-    }
+    ApplyFilter<4>(output, input, get_lut(), sample_rate_ratio, fraction, samples_to_write,
+                   vectorize);
 }
 
 static void ResampleHighQuality(std::span<s32> output, std::span<const s16> input,
                                 const Common::FixedPoint<49, 15>& sample_rate_ratio,
-                                Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write) {
+                                Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write,
+                                const bool vectorize) {
     static constexpr std::array<f32, 1024> lut0 = {
         -0.01776123f, -0.00070190f, 0.26672363f,  0.50006104f,  0.26956177f,  0.00024414f,
         -0.01800537f, 0.00000000f,  -0.01748657f, -0.00164795f, 0.26388550f,  0.50003052f,
@@ -842,42 +979,41 @@ static void ResampleHighQuality(std::span<s32> output, std::span<const s16> inpu
         }
     };
 
-    auto lut{get_lut()};
-    u32 read_index{0};
-    for (u32 i = 0; i < samples_to_write; i++) {
-        const auto lut_index{(fraction.get_frac() >> 8) * 8};
-        const Common::FixedPoint<56, 8> sample0{input[read_index + 0] * lut[lut_index + 0]};
-        const Common::FixedPoint<56, 8> sample1{input[read_index + 1] * lut[lut_index + 1]};
-        const Common::FixedPoint<56, 8> sample2{input[read_index + 2] * lut[lut_index + 2]};
-        const Common::FixedPoint<56, 8> sample3{input[read_index + 3] * lut[lut_index + 3]};
-        const Common::FixedPoint<56, 8> sample4{input[read_index + 4] * lut[lut_index + 4]};
-        const Common::FixedPoint<56, 8> sample5{input[read_index + 5] * lut[lut_index + 5]};
-        const Common::FixedPoint<56, 8> sample6{input[read_index + 6] * lut[lut_index + 6]};
-        const Common::FixedPoint<56, 8> sample7{input[read_index + 7] * lut[lut_index + 7]};
-        output[i] = (sample0 + sample1 + sample2 + sample3 + sample4 + sample5 + sample6 + sample7)
-                        .to_int_floor();
-        fraction += sample_rate_ratio;
-        read_index += static_cast<u32>(fraction.to_int_floor());
-        fraction.clear_int();
-    }
+    ApplyFilter<8>(output, input, get_lut(), sample_rate_ratio, fraction, samples_to_write,
+                   vectorize);
 }
 
-void Resample(std::span<s32> output, std::span<const s16> input,
-              const Common::FixedPoint<49, 15>& sample_rate_ratio,
-              Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write,
-              const SrcQuality src_quality) {
-
+static void ResampleImpl(std::span<s32> output, std::span<const s16> input,
+                         const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                         Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write,
+                         const SrcQuality src_quality, const bool vectorize) {
     switch (src_quality) {
     case SrcQuality::Low:
         ResampleLowQuality(output, input, sample_rate_ratio, fraction, samples_to_write);
         break;
     case SrcQuality::Medium:
-        ResampleNormalQuality(output, input, sample_rate_ratio, fraction, samples_to_write);
+        ResampleNormalQuality(output, input, sample_rate_ratio, fraction, samples_to_write,
+                              vectorize);
         break;
     case SrcQuality::High:
-        ResampleHighQuality(output, input, sample_rate_ratio, fraction, samples_to_write);
+        ResampleHighQuality(output, input, sample_rate_ratio, fraction, samples_to_write,
+                            vectorize);
         break;
     }
 }
 
+void Resample(std::span<s32> output, std::span<const s16> input,
+              const Common::FixedPoint<49, 15>& sample_rate_ratio,
+              Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write,
+              const SrcQuality src_quality) {
+    ResampleImpl(output, input, sample_rate_ratio, fraction, samples_to_write, src_quality, true);
+}
+
+void ResampleScalar(std::span<s32> output, std::span<const s16> input,
+                    const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                    Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write,
+                    const SrcQuality src_quality) {
+    ResampleImpl(output, input, sample_rate_ratio, fraction, samples_to_write, src_quality, false);
+}
+
 } // namespace AudioCore::Renderer
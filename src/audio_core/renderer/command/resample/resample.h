@@ -26,4 +26,13 @@ void Resample(std::span<s32> output, std::span<const s16> input,
               const Common::FixedPoint<49, 15>& sample_rate_ratio,
               Common::FixedPoint<49, 15>& fraction, u32 samples_to_write, SrcQuality src_quality);
 
+/**
+ * Resample without the vector filter paths. Produces the same output as Resample, used for
+ * testing.
+ */
+void ResampleScalar(std::span<s32> output, std::span<const s16> input,
+                    const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                    Common::FixedPoint<49, 15>& fraction, u32 samples_to_write,
+                    SrcQuality src_quality);
+
 } // namespace AudioCore::Renderer
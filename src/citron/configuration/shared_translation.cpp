@@ -144,6 +144,14 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
            tr("Allows saving shaders to storage for faster loading on following game "
               "boots.\nDisabling "
               "it is only intended for debugging."));
+    INSERT(Settings, use_background_pipeline_loading,
+           tr("Load rarely used pipelines in background"),
+           tr("Starts the game once the pipelines used in recent sessions are built and keeps "
+              "building the rest of the disk pipeline cache in the background."));
+    INSERT(Settings, use_disk_texture_cache, tr("Use disk texture cache"),
+           tr("Saves textures decoded on the CPU, such as ASTC, to storage and loads them on "
+              "following game boots instead of decoding them again.\nThe cache can use several "
+              "gigabytes of storage per game."));
     INSERT(
         Settings, use_asynchronous_gpu_emulation, tr("Use asynchronous GPU emulation"),
         tr("Uses an extra CPU thread for rendering.\nThis option should always remain enabled."));
@@ -222,6 +230,10 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
         Settings, use_reactive_flushing, tr("Enable Reactive Flushing"),
         tr("Uses reactive flushing instead of predictive flushing, allowing more accurate memory "
            "syncing."));
+    INSERT(Settings, use_predictive_downloads, tr("Predict GPU readbacks"),
+           tr("Learns which memory the game reads back from the GPU and downloads only that "
+              "memory at the end of each frame, so later reads do not wait for the GPU.\nRequires "
+              "reactive flushing."));
     INSERT(Settings, use_video_framerate, tr("Sync to framerate of video playback"),
            tr("Run the game at normal speed during video playback, even when the framerate is "
               "unlocked."));
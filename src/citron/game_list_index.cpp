@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "citron/game_list_index.h"
+
+namespace {
+
+constexpr quint32 IndexMagic = 0x49474C43; // CLGI
+constexpr quint32 IndexVersion = 1;
+
+} // Anonymous namespace
+
+GameListIndex::GameListIndex(std::filesystem::path path_) : path{std::move(path_)} {}
+
+GameListIndex::~GameListIndex() = default;
+
+void GameListIndex::Load() {
+    std::scoped_lock lk{mutex};
+    entries.clear();
+    dirty = false;
+
+    QFile file{QString::fromStdString(Common::FS::PathToUTF8String(path))};
+    if (!file.open(QFile::ReadOnly)) {
+        return;
+    }
+
+    QDataStream stream{&file};
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic{};
+    quint32 version{};
+    quint32 num_entries{};
+    stream >> magic >> version >> num_entries;
+    if (magic != IndexMagic || version != IndexVersion) {
+        LOG_INFO(Frontend, "Ignoring game list index from another version");
+        return;
+    }
+
+    for (quint32 i = 0; i < num_entries && stream.status() == QDataStream::Ok; ++i) {
+        QString file_path;
+        Entry entry;
+        quint64 size{};
+        qint64 modified{};
+        quint32 num_titles{};
+        stream >> file_path >> size >> modified >> num_titles;
+
+        entry.size = size;
+        entry.modified = modified;
+        for (quint32 j = 0; j < num_titles && stream.status() == QDataStream::Ok; ++j) {
+            Title& title = entry.titles.emplace_back();
+            quint64 program_id{};
+            QString name;
+            QByteArray icon;
+            stream >> program_id >> title.file_type >> name >> icon >> title.patch_versions;
+            title.program_id = program_id;
+            title.name = name.toStdString();
+            title.icon.assign(icon.begin(), icon.end());
+        }
+        entries.insert_or_assign(file_path.toStdString(), std::move(entry));
+    }
+
+    if (stream.status() != QDataStream::Ok) {
+        LOG_ERROR(Frontend, "Game list index is corrupted, rescanning all files");
+        entries.clear();
+    }
+}
+
+bool GameListIndex::Save(bool prune) {
+    std::scoped_lock lk{mutex};
+    if (prune) {
+        const auto num_erased =
+            std::erase_if(entries, [](const auto& pair) { return !pair.second.used; });
+        dirty |= num_erased != 0;
+    }
+    if (!dirty) {
+        return true;
+    }
+
+    void(Common::FS::CreateParentDirs(path));
+    QSaveFile file{QString::fromStdString(Common::FS::PathToUTF8String(path))};
+    if (!file.open(QFile::WriteOnly)) {
+        LOG_ERROR(Frontend, "Failed to open game list index for writing");
+        return false;
+    }
+
+    QDataStream stream{&file};
+    stream.setVersion(QDataStream::Qt_6_0);
+    stream << IndexMagic << IndexVersion << static_cast<quint32>(entries.size());
+    for (const auto& [file_path, entry] : entries) {
+        stream << QString::fromStdString(file_path) << static_cast<quint64>(entry.size)
+               << static_cast<qint64>(entry.modified) << static_cast<quint32>(entry.titles.size());
+        for (const Title& title : entry.titles) {
+            stream << static_cast<quint64>(title.program_id) << title.file_type
+                   << QString::fromStdString(title.name)
+                   << QByteArray(reinterpret_cast<const char*>(title.icon.data()),
+                                 static_cast<qsizetype>(title.icon.size()))
+                   << title.patch_versions;
+        }
+    }
+
+    if (!file.commit()) {
+        LOG_ERROR(Frontend, "Failed to write game list index");
+        return false;
+    }
+    dirty = false;
+    return true;
+}
+
+std::optional<std::vector<GameListIndex::Title>> GameListIndex::Find(const std::string& file_path,
+                                                                     u64 size, s64 modified) {
+    std::scoped_lock lk{mutex};
+    const auto it = entries.find(file_path);
+    if (it == entries.end() || it->second.size != size || it->second.modified != modified) {
+        return std::nullopt;
+    }
+    it->second.used = true;
+    return it->second.titles;
+}
+
+void GameListIndex::Insert(const std::string& file_path, u64 size, s64 modified,
+                           std::vector<Title> titles) {
+    std::scoped_lock lk{mutex};
+    entries.insert_or_assign(file_path, Entry{size, modified, std::move(titles), true});
+    dirty = true;
+}
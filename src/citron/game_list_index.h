@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <QString>
+
+#include "common/common_types.h"
+
+/**
+ * Persistent index of the metadata the game list reads from game files.
+ *
+ * Files are keyed by their path, and an entry is only returned while the size and modification
+ * time of the file match the ones it was indexed with, so that only changed files are opened and
+ * parsed again. The index lives in the game list cache directory, and is dropped with it.
+ */
+class GameListIndex {
+public:
+    struct Title {
+        u64 program_id{};
+        u32 file_type{};
+        std::string name;
+        std::vector<u8> icon;
+        /// Update version and add-ons, as shown in the game list. Titles with an ID read them
+        /// from the add-ons cache instead, which is cleared when their add-ons are configured.
+        QString patch_versions;
+    };
+
+    explicit GameListIndex(std::filesystem::path path_);
+    ~GameListIndex();
+
+    /// Reads the index from disk, starting empty if it is missing or from another version.
+    void Load();
+
+    /// Writes the index to disk.
+    /// @param prune Drop the files that were not looked up or inserted since Load
+    bool Save(bool prune);
+
+    /// Returns the titles of a file, if it did not change since it was indexed.
+    [[nodiscard]] std::optional<std::vector<Title>> Find(const std::string& file_path, u64 size,
+                                                         s64 modified);
+
+    void Insert(const std::string& file_path, u64 size, s64 modified, std::vector<Title> titles);
+
+private:
+    struct Entry {
+        u64 size{};
+        s64 modified{};
+        std::vector<Title> titles;
+        bool used{};
+    };
+
+    std::filesystem::path path;
+    std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+    bool dirty{};
+};
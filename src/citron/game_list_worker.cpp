@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -9,7 +11,9 @@
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QSaveFile>
 #include <QSettings>
+#include <QtConcurrent/QtConcurrentMap>
 
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
@@ -25,41 +29,57 @@
 #include "core/loader/loader.h"
 #include "citron/compatibility_list.h"
 #include "citron/game_list.h"
+#include "citron/game_list_index.h"
 #include "citron/game_list_p.h"
 #include "citron/game_list_worker.h"
 #include "citron/uisettings.h"
 
 namespace {
 
+/// Guards the game list cache files, which titles scanned in parallel may share.
+std::mutex cache_mutex;
+
+std::string GetGameListCachePath(const std::string& filename, const std::string& ext) {
+    return Common::FS::PathToUTF8String(
+        Common::FS::GetCitronPath(Common::FS::CitronPath::CacheDir) / "game_list" /
+        fmt::format("{}.{}", filename, ext));
+}
+
+/// Reads a cached text object, if it exists.
+std::optional<QString> FindGameListCachedObject(const std::string& filename,
+                                                const std::string& ext) {
+    std::scoped_lock lk{cache_mutex};
+    QFile file{QString::fromStdString(GetGameListCachePath(filename, ext))};
+    if (!file.open(QFile::ReadOnly)) {
+        return std::nullopt;
+    }
+    return QString::fromUtf8(file.readAll());
+}
+
 QString GetGameListCachedObject(const std::string& filename, const std::string& ext,
                                 const std::function<QString()>& generator) {
     if (!UISettings::values.cache_game_list || filename == "0000000000000000") {
         return generator();
     }
 
-    const auto path =
-        Common::FS::PathToUTF8String(Common::FS::GetCitronPath(Common::FS::CitronPath::CacheDir) /
-                                     "game_list" / fmt::format("{}.{}", filename, ext));
-
-    void(Common::FS::CreateParentDirs(path));
-
-    if (!Common::FS::Exists(path)) {
-        const auto str = generator();
+    if (auto str = FindGameListCachedObject(filename, ext)) {
+        return *std::move(str);
+    }
 
-        QFile file{QString::fromStdString(path)};
-        if (file.open(QFile::WriteOnly)) {
-            file.write(str.toUtf8());
-        }
+    // The object is generated outside of the lock, so titles sharing it may both generate it.
+    const auto str = generator();
 
-        return str;
-    }
+    std::scoped_lock lk{cache_mutex};
+    const auto path = GetGameListCachePath(filename, ext);
+    void(Common::FS::CreateParentDirs(path));
 
-    QFile file{QString::fromStdString(path)};
-    if (file.open(QFile::ReadOnly)) {
-        return QString::fromUtf8(file.readAll());
+    QSaveFile file{QString::fromStdString(path)};
+    if (file.open(QFile::WriteOnly)) {
+        file.write(str.toUtf8());
+        file.commit();
     }
 
-    return generator();
+    return str;
 }
 
 std::pair<std::vector<u8>, std::string> GetGameListCachedObject(
@@ -77,6 +97,7 @@ std::pair<std::vector<u8>, std::string> GetGameListCachedObject(
     const auto path1 = Common::FS::PathToUTF8String(game_list_dir / jpeg_name);
     const auto path2 = Common::FS::PathToUTF8String(game_list_dir / app_name);
 
+    std::scoped_lock lk{cache_mutex};
     void(Common::FS::CreateParentDirs(path1));
 
     if (!Common::FS::Exists(path1) || !Common::FS::Exists(path2)) {
@@ -191,12 +212,19 @@ QString FormatPatchNameVersions(const FileSys::PatchManager& patch_manager,
     return out;
 }
 
+QString GetPatchVersions(const FileSys::PatchManager& patch, Loader::AppLoader& loader) {
+    return GetGameListCachedObject(
+        fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &loader] {
+            return FormatPatchNameVersions(patch, loader, loader.IsRomFSUpdatable());
+        });
+}
+
 QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::string& name,
                                         const std::size_t size, const std::vector<u8>& icon,
-                                        Loader::AppLoader& loader, u64 program_id,
+                                        Loader::FileType file_type, u64 program_id,
+                                        const QString& patch_versions,
                                         const CompatibilityList& compatibility_list,
-                                        const PlayTime::PlayTimeManager& play_time_manager,
-                                        const FileSys::PatchManager& patch) {
+                                        const PlayTime::PlayTimeManager& play_time_manager) {
     const auto it = FindMatchingCompatibilityEntry(compatibility_list, program_id);
 
     // The game list uses this as compatibility number for untested games
@@ -205,7 +233,6 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::stri
         compatibility = it->second.first;
     }
 
-    const auto file_type = loader.GetFileType();
     const auto file_type_string = QString::fromStdString(Loader::GetFileTypeString(file_type));
 
     QList<QStandardItem*> list{
@@ -216,15 +243,41 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::stri
         new GameListItemSize(size),
         new GameListItemPlayTime(play_time_manager.GetPlayTime(program_id)),
     };
-
-    const auto patch_versions = GetGameListCachedObject(
-        fmt::format("{:016X}", patch.GetTitleID()), "pv.txt", [&patch, &loader] {
-            return FormatPatchNameVersions(patch, loader, loader.IsRomFSUpdatable());
-        });
     list.insert(2, new GameListItem(patch_versions));
 
     return list;
 }
+
+/// Replaces the add-ons of indexed titles with the cached ones. The add-ons cache of a title is
+/// removed when its add-ons are configured, so the file is read again when one of them is missing.
+bool RefreshPatchVersions(std::vector<GameListIndex::Title>& titles) {
+    for (auto& title : titles) {
+        if (title.program_id == 0) {
+            continue;
+        }
+        auto patch_versions =
+            FindGameListCachedObject(fmt::format("{:016X}", title.program_id), "pv.txt");
+        if (!patch_versions) {
+            return false;
+        }
+        title.patch_versions = *std::move(patch_versions);
+    }
+    return true;
+}
+
+/// Reads the metadata of a title for the game list.
+GameListIndex::Title ReadTitle(const FileSys::PatchManager& patch, Loader::AppLoader& loader,
+                               u64 program_id) {
+    GameListIndex::Title title{
+        .program_id = program_id,
+        .file_type = static_cast<u32>(loader.GetFileType()),
+        .name = " ",
+    };
+    [[maybe_unused]] const auto res1 = loader.ReadIcon(title.icon);
+    [[maybe_unused]] const auto res3 = loader.ReadTitle(title.name);
+    title.patch_versions = GetPatchVersions(patch, loader);
+    return title;
+}
 } // Anonymous namespace
 
 GameListWorker::GameListWorker(FileSys::VirtualFilesystem vfs_,
@@ -328,15 +381,18 @@ void GameListWorker::AddTitlesToGameList(GameListDir* parent_dir) {
             GetMetadataFromControlNCA(patch, *control, icon, name);
         }
 
-        auto entry = MakeGameListEntry(file->GetFullPath(), name, file->GetSize(), icon, *loader,
-                                       program_id, compatibility_list, play_time_manager, patch);
+        auto entry = MakeGameListEntry(file->GetFullPath(), name, file->GetSize(), icon,
+                                       loader->GetFileType(), program_id,
+                                       GetPatchVersions(patch, *loader), compatibility_list,
+                                       play_time_manager);
         RecordEvent([=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
     }
 }
 
 void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
                                     GameListDir* parent_dir) {
-    const auto callback = [this, target, parent_dir](const std::filesystem::path& path) -> bool {
+    std::vector<std::string> game_files;
+    const auto callback = [this, &game_files](const std::filesystem::path& path) -> bool {
         if (stop_requested) {
             // Breaks the callback loop.
             return false;
@@ -347,88 +403,7 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
 
         if (!is_dir &&
             (HasSupportedFileExtension(physical_name) || IsExtractedNCAMain(physical_name))) {
-            const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
-            if (!file) {
-                return true;
-            }
-
-            auto loader = Loader::GetLoader(system, file);
-            if (!loader) {
-                return true;
-            }
-
-            const auto file_type = loader->GetFileType();
-            if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
-                return true;
-            }
-
-            u64 program_id = 0;
-            const auto res2 = loader->ReadProgramId(program_id);
-
-            if (target == ScanTarget::FillManualContentProvider) {
-                if (res2 == Loader::ResultStatus::Success && file_type == Loader::FileType::NCA) {
-                    provider->AddEntry(FileSys::TitleType::Application,
-                                       FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()),
-                                       program_id, file);
-                } else if (res2 == Loader::ResultStatus::Success &&
-                           (file_type == Loader::FileType::XCI ||
-                            file_type == Loader::FileType::NSP)) {
-                    const auto nsp = file_type == Loader::FileType::NSP
-                                         ? std::make_shared<FileSys::NSP>(file)
-                                         : FileSys::XCI{file}.GetSecurePartitionNSP();
-                    for (const auto& title : nsp->GetNCAs()) {
-                        for (const auto& entry : title.second) {
-                            provider->AddEntry(entry.first.first, entry.first.second, title.first,
-                                               entry.second->GetBaseFile());
-                        }
-                    }
-                }
-            } else {
-                std::vector<u64> program_ids;
-                loader->ReadProgramIds(program_ids);
-
-                if (res2 == Loader::ResultStatus::Success && program_ids.size() > 1 &&
-                    (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
-                    for (const auto id : program_ids) {
-                        loader = Loader::GetLoader(system, file, id);
-                        if (!loader) {
-                            continue;
-                        }
-
-                        std::vector<u8> icon;
-                        [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
-
-                        std::string name = " ";
-                        [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
-
-                        const FileSys::PatchManager patch{id, system.GetFileSystemController(),
-                                                          system.GetContentProvider()};
-
-                        auto entry = MakeGameListEntry(
-                            physical_name, name, Common::FS::GetSize(physical_name), icon, *loader,
-                            id, compatibility_list, play_time_manager, patch);
-
-                        RecordEvent(
-                            [=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
-                    }
-                } else {
-                    std::vector<u8> icon;
-                    [[maybe_unused]] const auto res1 = loader->ReadIcon(icon);
-
-                    std::string name = " ";
-                    [[maybe_unused]] const auto res3 = loader->ReadTitle(name);
-
-                    const FileSys::PatchManager patch{program_id, system.GetFileSystemController(),
-                                                      system.GetContentProvider()};
-
-                    auto entry = MakeGameListEntry(
-                        physical_name, name, Common::FS::GetSize(physical_name), icon, *loader,
-                        program_id, compatibility_list, play_time_manager, patch);
-
-                    RecordEvent(
-                        [=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
-                }
-            }
+            game_files.push_back(physical_name);
         } else if (is_dir) {
             watch_list.append(QString::fromStdString(physical_name));
         }
@@ -442,12 +417,146 @@ void GameListWorker::ScanFileSystem(ScanTarget target, const std::string& dir_pa
     } else {
         Common::FS::IterateDirEntries(dir_path, callback, Common::FS::DirEntryFilter::File);
     }
+
+    if (target == ScanTarget::FillManualContentProvider) {
+        // The content provider is not thread safe, so it is filled one file at a time.
+        for (const auto& physical_name : game_files) {
+            if (stop_requested) {
+                break;
+            }
+            FillManualContentProvider(physical_name);
+        }
+        return;
+    }
+
+    // Files are independent once the content provider is filled, so they are spread over the
+    // global thread pool. Files that did not change since the last scan are read from the index.
+    QtConcurrent::blockingMap(game_files, [this, parent_dir](const std::string& physical_name) {
+        if (!stop_requested) {
+            AddFileToGameList(physical_name, parent_dir);
+        }
+    });
+}
+
+void GameListWorker::FillManualContentProvider(const std::string& physical_name) {
+    const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
+    if (!file) {
+        return;
+    }
+
+    const auto loader = Loader::GetLoader(system, file);
+    if (!loader) {
+        return;
+    }
+
+    const auto file_type = loader->GetFileType();
+    u64 program_id = 0;
+    if (loader->ReadProgramId(program_id) != Loader::ResultStatus::Success) {
+        return;
+    }
+
+    if (file_type == Loader::FileType::NCA) {
+        provider->AddEntry(FileSys::TitleType::Application,
+                           FileSys::GetCRTypeFromNCAType(FileSys::NCA{file}.GetType()), program_id,
+                           file);
+    } else if (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP) {
+        const auto nsp = file_type == Loader::FileType::NSP
+                             ? std::make_shared<FileSys::NSP>(file)
+                             : FileSys::XCI{file}.GetSecurePartitionNSP();
+        for (const auto& title : nsp->GetNCAs()) {
+            for (const auto& entry : title.second) {
+                provider->AddEntry(entry.first.first, entry.first.second, title.first,
+                                   entry.second->GetBaseFile());
+            }
+        }
+    }
+}
+
+std::vector<GameListIndex::Title> GameListWorker::ReadFileTitles(const std::string& physical_name) {
+    const auto file = vfs->OpenFile(physical_name, FileSys::OpenMode::Read);
+    if (!file) {
+        return {};
+    }
+
+    auto loader = Loader::GetLoader(system, file);
+    if (!loader) {
+        return {};
+    }
+
+    const auto file_type = loader->GetFileType();
+    if (file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) {
+        return {};
+    }
+
+    u64 program_id = 0;
+    const auto res2 = loader->ReadProgramId(program_id);
+
+    std::vector<u64> program_ids;
+    loader->ReadProgramIds(program_ids);
+
+    std::vector<GameListIndex::Title> titles;
+    if (res2 == Loader::ResultStatus::Success && program_ids.size() > 1 &&
+        (file_type == Loader::FileType::XCI || file_type == Loader::FileType::NSP)) {
+        for (const auto id : program_ids) {
+            loader = Loader::GetLoader(system, file, id);
+            if (!loader) {
+                continue;
+            }
+
+            const FileSys::PatchManager patch{id, system.GetFileSystemController(),
+                                              system.GetContentProvider()};
+            titles.push_back(ReadTitle(patch, *loader, id));
+        }
+    } else {
+        const FileSys::PatchManager patch{program_id, system.GetFileSystemController(),
+                                          system.GetContentProvider()};
+        titles.push_back(ReadTitle(patch, *loader, program_id));
+    }
+    return titles;
+}
+
+void GameListWorker::AddFileToGameList(const std::string& physical_name,
+                                       GameListDir* parent_dir) {
+    const QFileInfo file_info{QString::fromStdString(physical_name)};
+    const auto size = static_cast<u64>(file_info.size());
+    const auto modified = file_info.lastModified().toMSecsSinceEpoch();
+
+    std::optional<std::vector<GameListIndex::Title>> titles;
+    if (index) {
+        titles = index->Find(physical_name, size, modified);
+    }
+    if (titles && !RefreshPatchVersions(*titles)) {
+        titles.reset();
+    }
+    if (!titles) {
+        titles = ReadFileTitles(physical_name);
+        if (index && !titles->empty()) {
+            index->Insert(physical_name, size, modified, *titles);
+        }
+    }
+
+    for (const auto& title : *titles) {
+        auto entry = MakeGameListEntry(physical_name, title.name, size, title.icon,
+                                       static_cast<Loader::FileType>(title.file_type),
+                                       title.program_id, title.patch_versions, compatibility_list,
+                                       play_time_manager);
+        RecordEvent([=](GameList* game_list) { game_list->AddEntry(entry, parent_dir); });
+    }
 }
 
 void GameListWorker::run() {
     watch_list.clear();
     provider->ClearAllEntries();
 
+    if (UISettings::values.cache_game_list) {
+        index = std::make_unique<GameListIndex>(
+            Common::FS::GetCitronPath(Common::FS::CitronPath::CacheDir) / "game_list" /
+            "index.bin");
+        index->Load();
+    } else {
+        index.reset();
+    }
+
     const auto DirEntryReady = [&](GameListDir* game_list_dir) {
         RecordEvent([=](GameList* game_list) { game_list->AddDirEntry(game_list_dir); });
     };
@@ -480,6 +589,11 @@ void GameListWorker::run() {
         }
     }
 
+    if (index) {
+        // Files missing from a complete scan were removed, so they are dropped from the index.
+        index->Save(!stop_requested);
+    }
+
     RecordEvent([this](GameList* game_list) { game_list->DonePopulating(watch_list); });
     processing_completed.Set();
 }
@@ -7,6 +7,7 @@
 #include <deque>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <QList>
 #include <QObject>
@@ -15,6 +16,7 @@
 
 #include "common/thread.h"
 #include "citron/compatibility_list.h"
+#include "citron/game_list_index.h"
 #include "citron/play_time_manager.h"
 
 namespace Core {
@@ -75,6 +77,9 @@ private:
 
     void ScanFileSystem(ScanTarget target, const std::string& dir_path, bool deep_scan,
                         GameListDir* parent_dir);
+    void FillManualContentProvider(const std::string& physical_name);
+    std::vector<GameListIndex::Title> ReadFileTitles(const std::string& physical_name);
+    void AddFileToGameList(const std::string& physical_name, GameListDir* parent_dir);
 
     std::shared_ptr<FileSys::VfsFilesystem> vfs;
     FileSys::ManualContentProvider* provider;
@@ -83,6 +88,7 @@ private:
     const PlayTime::PlayTimeManager& play_time_manager;
 
     QStringList watch_list;
+    std::unique_ptr<GameListIndex> index;
 
     std::mutex lock;
     std::condition_variable cv;
@@ -127,10 +127,12 @@ static FileSys::VirtualFile VfsDirectoryCreateFileWrapper(const FileSys::Virtual
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/service/am/am.h"
 #include "core/hle/service/filesystem/filesystem.h"
+#include "core/hle/service/service_statistics.h"
 #include "core/hle/service/sm/sm.h"
 #include "core/loader/loader.h"
 #include "core/perf_stats.h"
 #include "core/telemetry_session.h"
+#include "core/tools/guest_profiler.h"
 #include "frontend_common/config.h"
 #include "input_common/drivers/tas_input.h"
 #include "input_common/drivers/virtual_amiibo.h"
@@ -1379,6 +1381,18 @@ void GMainWindow::InitializeHotkeys() {
     connect_shortcut(QStringLiteral("Toggle Framerate Limit"), [] {
         Settings::values.use_speed_limit.SetValue(!Settings::values.use_speed_limit.GetValue());
     });
+    connect_shortcut(QStringLiteral("Dump Guest Profile"), [this] {
+        if (emulation_running) {
+            if (auto* guest_profiler = system->GetGuestProfiler()) {
+                guest_profiler->Dump();
+            }
+        }
+    });
+    connect_shortcut(QStringLiteral("Dump Service Statistics"), [this] {
+        if (emulation_running && Settings::values.record_service_statistics) {
+            system->GetServiceStatistics().Dump();
+        }
+    });
     connect_shortcut(QStringLiteral("Toggle Renderdoc Capture"), [this] {
         if (Settings::values.enable_renderdoc_hotkey) {
             system->GetRenderdocAPI().ToggleCapture();
@@ -3236,10 +3250,10 @@ void GMainWindow::OnMenuInstallToNAND() {
 
     int remaining = filenames.size();
 
-    // This would only overflow above 2^51 bytes (2.252 PB)
+    // This would only overflow above 2^53 bytes (9.007 PB)
     int total_size = 0;
     for (const QString& file : files) {
-        total_size += static_cast<int>(QFile(file).size() / CopyBufferSize);
+        total_size += static_cast<int>(QFile(file).size() / FileSys::VFS_RC_LARGE_COPY_BLOCK);
     }
     if (total_size < 0) {
         LOG_CRITICAL(Frontend, "Attempting to install too many files, aborting.");
@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <unordered_map>
+
+#include <fmt/format.h>
+#include <nlohmann/json.hpp>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+#include "citron_cmd/benchmark.h"
+#include "common/fs/fs_util.h"
+#include "common/logging/log.h"
+#include "common/scm_rev.h"
+#include "common/settings.h"
+#include "core/core.h"
+#include "core/perf_stats.h"
+#include "video_core/gpu.h"
+#include "video_core/shader_notify.h"
+
+namespace {
+
+double Percentile(std::vector<double> sorted_values, double percentile) {
+    if (sorted_values.empty()) {
+        return 0.0;
+    }
+    const double rank = percentile / 100.0 * static_cast<double>(sorted_values.size() - 1);
+    const size_t lower = static_cast<size_t>(std::floor(rank));
+    const size_t upper = std::min(lower + 1, sorted_values.size() - 1);
+    const double weight = rank - static_cast<double>(lower);
+    return sorted_values[lower] * (1.0 - weight) + sorted_values[upper] * weight;
+}
+
+} // Anonymous namespace
+
+Benchmark::Benchmark(Core::System& system_, std::size_t num_frames_,
+                     std::filesystem::path report_path_)
+    : system{system_}, num_frames{num_frames_}, report_path{std::move(report_path_)} {}
+
+Benchmark::~Benchmark() = default;
+
+void Benchmark::Start() {
+    const auto& shader_notify = system.GPU().ShaderNotify();
+    first_frame = system.GetPerfStats().GetRecordedFrameCount();
+    first_shaders_queued = shader_notify.ShadersQueued();
+    first_shaders_completed = shader_notify.ShadersCompleted();
+    start_thread_times = SampleThreadTimes();
+    start_time = std::chrono::steady_clock::now();
+
+    const size_t max_frames = Core::PerfStats::MaxRecordedFrames - first_frame;
+    if (num_frames > max_frames) {
+        LOG_WARNING(Frontend, "Benchmark is limited to {} frames", max_frames);
+        num_frames = max_frames;
+    }
+    LOG_INFO(Frontend, "Benchmark started, measuring {} frames", num_frames);
+}
+
+void Benchmark::Stop() {
+    if (stopped) {
+        return;
+    }
+    const auto& shader_notify = system.GPU().ShaderNotify();
+    stop_time = std::chrono::steady_clock::now();
+    stop_thread_times = SampleThreadTimes();
+    last_frame = std::min(system.GetPerfStats().GetRecordedFrameCount(), first_frame + num_frames);
+    last_shaders_queued = shader_notify.ShadersQueued();
+    last_shaders_completed = shader_notify.ShadersCompleted();
+    stopped = true;
+}
+
+bool Benchmark::IsComplete() const {
+    return system.GetPerfStats().GetRecordedFrameCount() >= first_frame + num_frames;
+}
+
+bool Benchmark::WriteReport() const {
+    std::vector<double> frametimes = system.GetPerfStats().GetFrametimes(first_frame);
+    frametimes.resize(std::min(frametimes.size(), last_frame - first_frame));
+
+    const double wall_seconds = std::chrono::duration<double>(stop_time - start_time).count();
+    const double total_ms = std::accumulate(frametimes.begin(), frametimes.end(), 0.0);
+
+    std::vector<double> sorted_frametimes = frametimes;
+    std::sort(sorted_frametimes.begin(), sorted_frametimes.end());
+
+    nlohmann::ordered_json report;
+    report["version"] = fmt::format("{} {}", Common::g_scm_branch, Common::g_scm_desc);
+    report["program_id"] = fmt::format("{:016X}", system.GetApplicationProcessProgramID());
+    report["renderer"] = Settings::CanonicalizeEnum(Settings::values.renderer_backend.GetValue());
+    report["requested_frames"] = num_frames;
+    report["frames"] = frametimes.size();
+    report["completed"] = frametimes.size() == num_frames;
+    report["wall_time_s"] = wall_seconds;
+
+    auto& summary = report["frametime_ms"];
+    summary["mean"] = frametimes.empty() ? 0.0 : total_ms / static_cast<double>(frametimes.size());
+    summary["min"] = sorted_frametimes.empty() ? 0.0 : sorted_frametimes.front();
+    summary["max"] = sorted_frametimes.empty() ? 0.0 : sorted_frametimes.back();
+    summary["p50"] = Percentile(sorted_frametimes, 50.0);
+    summary["p95"] = Percentile(sorted_frametimes, 95.0);
+    summary["p99"] = Percentile(sorted_frametimes, 99.0);
+
+    auto& shaders = report["shaders"];
+    shaders["queued"] = last_shaders_queued - first_shaders_queued;
+    shaders["completed"] = last_shaders_completed - first_shaders_completed;
+    shaders["total_completed"] = last_shaders_completed;
+
+    std::unordered_map<u64, double> start_cpu_seconds;
+    for (const ThreadTime& thread : start_thread_times) {
+        start_cpu_seconds.emplace(thread.tid, thread.cpu_seconds);
+    }
+    auto threads = nlohmann::ordered_json::array();
+    for (const ThreadTime& thread : stop_thread_times) {
+        const auto it = start_cpu_seconds.find(thread.tid);
+        const double cpu_seconds =
+            thread.cpu_seconds - (it != start_cpu_seconds.end() ? it->second : 0.0);
+        if (cpu_seconds <= 0.0) {
+            continue;
+        }
+        threads.push_back({
+            {"name", thread.name},
+            {"tid", thread.tid},
+            {"cpu_time_s", cpu_seconds},
+            {"utilization", wall_seconds > 0.0 ? cpu_seconds / wall_seconds : 0.0},
+        });
+    }
+    report["threads"] = std::move(threads);
+    report["frametimes"] = std::move(frametimes);
+
+    std::ofstream file{report_path, std::ios::trunc};
+    if (!file) {
+        LOG_ERROR(Frontend, "Failed to open benchmark report {}",
+                  Common::FS::PathToUTF8String(report_path));
+        return false;
+    }
+    file << report.dump(4) << std::endl;
+    if (!file) {
+        LOG_ERROR(Frontend, "Failed to write benchmark report {}",
+                  Common::FS::PathToUTF8String(report_path));
+        return false;
+    }
+    LOG_INFO(Frontend, "Benchmark report written to {}",
+             Common::FS::PathToUTF8String(report_path));
+    return true;
+}
+
+std::vector<Benchmark::ThreadTime> Benchmark::SampleThreadTimes() {
+    std::vector<ThreadTime> thread_times;
+#ifdef __linux__
+    const double ticks_per_second = static_cast<double>(sysconf(_SC_CLK_TCK));
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator{"/proc/self/task", ec}) {
+        std::ifstream comm_file{entry.path() / "comm"};
+        std::ifstream stat_file{entry.path() / "stat"};
+        std::string name;
+        std::string stat;
+        if (!std::getline(comm_file, name) || !std::getline(stat_file, stat)) {
+            continue;
+        }
+        // The thread name in the stat line is parenthesized and may contain spaces
+        const size_t name_end = stat.rfind(')');
+        if (name_end == std::string::npos) {
+            continue;
+        }
+        std::istringstream fields{stat.substr(name_end + 1)};
+        std::string field;
+        u64 utime{};
+        u64 stime{};
+        // utime and stime are the 12th and 13th fields after the thread name
+        for (int index = 0; index < 13 && fields >> field; ++index) {
+            if (index == 11) {
+                utime = std::strtoull(field.c_str(), nullptr, 10);
+            } else if (index == 12) {
+                stime = std::strtoull(field.c_str(), nullptr, 10);
+            }
+        }
+        thread_times.push_back({
+            .tid = std::strtoull(entry.path().filename().string().c_str(), nullptr, 10),
+            .name = std::move(name),
+            .cpu_seconds = static_cast<double>(utime + stime) / ticks_per_second,
+        });
+    }
+#endif
+    return thread_times;
+}
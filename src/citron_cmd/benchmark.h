@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Core {
+class System;
+}
+
+/**
+ * Runs a booted title for a fixed number of system frames and writes a JSON report with the
+ * per-frame times, the CPU time spent by each emulator thread and the number of shaders built.
+ */
+class Benchmark {
+public:
+    explicit Benchmark(Core::System& system_, std::size_t num_frames_,
+                       std::filesystem::path report_path_);
+    ~Benchmark();
+
+    /// Starts measuring from the current frame.
+    void Start();
+
+    /// Stops measuring. Frames presented after this point are not part of the report.
+    void Stop();
+
+    /// Returns true when the requested number of frames has been presented.
+    [[nodiscard]] bool IsComplete() const;
+
+    /// Writes the report to disk. Returns false if the report could not be written.
+    bool WriteReport() const;
+
+private:
+    struct ThreadTime {
+        u64 tid;
+        std::string name;
+        double cpu_seconds;
+    };
+
+    [[nodiscard]] static std::vector<ThreadTime> SampleThreadTimes();
+
+    Core::System& system;
+    std::size_t num_frames;
+    std::filesystem::path report_path;
+
+    std::size_t first_frame{};
+    int first_shaders_queued{};
+    int first_shaders_completed{};
+    std::chrono::steady_clock::time_point start_time;
+    std::vector<ThreadTime> start_thread_times;
+
+    bool stopped{};
+    std::size_t last_frame{};
+    int last_shaders_queued{};
+    int last_shaders_completed{};
+    std::chrono::steady_clock::time_point stop_time;
+    std::vector<ThreadTime> stop_thread_times;
+};
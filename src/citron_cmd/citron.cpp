@@ -4,6 +4,7 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <regex>
 #include <string>
 #include <thread>
@@ -15,6 +16,7 @@
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/nvidia_flags.h"
+#include "common/polyfill_thread.h"
 #include "common/scm_rev.h"
 #include "common/scope_exit.h"
 #include "common/settings.h"
@@ -31,10 +33,13 @@
 #include "core/loader/loader.h"
 #include "core/telemetry_session.h"
 #include "frontend_common/config.h"
+#include "input_common/drivers/tas_input.h"
 #include "input_common/main.h"
 #include "network/network.h"
 #include "sdl_config.h"
 #include "video_core/renderer_base.h"
+#include "video_core/video_core.h"
+#include "citron_cmd/benchmark.h"
 #include "citron_cmd/emu_window/emu_window_sdl2.h"
 #include "citron_cmd/emu_window/emu_window_sdl2_gl.h"
 #include "citron_cmd/emu_window/emu_window_sdl2_null.h"
@@ -71,6 +76,7 @@ __declspec(dllexport) int AmdPowerXpressRequestHighPerformance = 1;
 static void PrintHelp(const char* argv0) {
     std::cout << "Usage: " << argv0
               << " [options] <filename>\n"
+                 "-b, --benchmark=frames Run the game for the given number of frames and exit\n"
                  "-c, --config          Load the specified configuration file\n"
                  "-f, --fullscreen      Start in fullscreen mode\n"
                  "-g, --game            File path of the game to load\n"
@@ -78,6 +84,10 @@ static void PrintHelp(const char* argv0) {
                  "-m, --multiplayer=nick:password@address:port"
                  " Nickname, password, address and port for multiplayer\n"
                  "-p, --program         Pass following string as arguments to executable\n"
+                 "-r, --benchmark-report Write the benchmark report to the specified file\n"
+                 "-s, --migrate-shader-cache"
+                 " Convert legacy pipeline caches to the current format and exit\n"
+                 "-t, --tas             Play back the TAS scripts once the game starts\n"
                  "-u, --user            Select a specific user profile from 0 to 7\n"
                  "-v, --version         Output version information and exit\n";
 }
@@ -214,6 +224,10 @@ int main(int argc, char** argv) {
 
     bool use_multiplayer = false;
     bool fullscreen = false;
+    bool migrate_shader_cache = false;
+    bool play_tas = false;
+    std::optional<size_t> benchmark_frames;
+    std::string benchmark_report_path{"benchmark.json"};
     std::string nickname{};
     std::string password{};
     std::string address{};
@@ -221,12 +235,16 @@ int main(int argc, char** argv) {
 
     static struct option long_options[] = {
         // clang-format off
+        {"benchmark", required_argument, 0, 'b'},
+        {"benchmark-report", required_argument, 0, 'r'},
         {"config", required_argument, 0, 'c'},
         {"fullscreen", no_argument, 0, 'f'},
         {"help", no_argument, 0, 'h'},
         {"game", required_argument, 0, 'g'},
         {"multiplayer", required_argument, 0, 'm'},
         {"program", optional_argument, 0, 'p'},
+        {"migrate-shader-cache", no_argument, 0, 's'},
+        {"tas", no_argument, 0, 't'},
         {"user", required_argument, 0, 'u'},
         {"version", no_argument, 0, 'v'},
         {0, 0, 0, 0},
@@ -234,9 +252,19 @@ int main(int argc, char** argv) {
     };
 
     while (optind < argc) {
-        int arg = getopt_long(argc, argv, "g:fhvp::c:u:", long_options, &option_index);
+        int arg = getopt_long(argc, argv, "g:fhvp::c:u:sb:r:t", long_options, &option_index);
         if (arg != -1) {
             switch (static_cast<char>(arg)) {
+            case 'b': {
+                const long frames = std::strtol(optarg, nullptr, 10);
+                if (frames <= 0) {
+                    std::cout << "Wrong format for option --benchmark\n";
+                    PrintHelp(argv[0]);
+                    return 0;
+                }
+                benchmark_frames = static_cast<size_t>(frames);
+                break;
+            }
             case 'c':
                 config_path = optarg;
                 break;
@@ -289,6 +317,15 @@ int main(int argc, char** argv) {
                 program_args = argv[optind];
                 ++optind;
                 break;
+            case 'r':
+                benchmark_report_path = optarg;
+                break;
+            case 's':
+                migrate_shader_cache = true;
+                break;
+            case 't':
+                play_tas = true;
+                break;
             case 'u':
                 selected_user = atoi(optarg);
                 break;
@@ -322,10 +359,20 @@ int main(int argc, char** argv) {
         Settings::values.current_user = std::clamp(*selected_user, 0, 7);
     }
 
+    if (play_tas) {
+        Settings::values.tas_enable = true;
+    }
+
 #ifdef _WIN32
     LocalFree(argv_w);
 #endif
 
+    if (migrate_shader_cache) {
+        const size_t num_migrated = VideoCore::MigratePipelineCaches();
+        std::cout << "Migrated " << num_migrated << " pipeline caches" << std::endl;
+        return 0;
+    }
+
     MicroProfileOnThreadCreate("EmuThread");
     SCOPE_EXIT {
         MicroProfileShutdown();
@@ -424,28 +471,62 @@ int main(int argc, char** argv) {
     system.GPU().Start();
     system.GetCpuManager().OnGpuReady();
 
-    if (Settings::values.use_disk_shader_cache.GetValue()) {
+    if (Settings::values.use_disk_shader_cache.GetValue() ||
+        Settings::values.use_disk_texture_cache.GetValue()) {
         system.Renderer().ReadRasterizer()->LoadDiskResources(
             system.GetApplicationProcessProgramID(), std::stop_token{},
             [](VideoCore::LoadCallbackStage, size_t value, size_t total) {});
     }
 
-    system.RegisterExitCallback([&] {
-        // Just exit right away.
-        exit(0);
-    });
+    std::optional<Benchmark> benchmark;
+    if (benchmark_frames) {
+        benchmark.emplace(system, *benchmark_frames, benchmark_report_path);
+        // Close the window instead of exiting so a partial report is still written
+        system.RegisterExitCallback([&] { emu_window->RequestClose(); });
+    } else {
+        system.RegisterExitCallback([&] {
+            // Just exit right away.
+            exit(0);
+        });
+    }
 
 #ifdef __unix__
     Common::Linux::StartGamemode();
 #endif
 
+    std::jthread benchmark_watcher;
+    if (benchmark) {
+        benchmark->Start();
+        benchmark_watcher = std::jthread([&](std::stop_token stop_token) {
+            while (!stop_token.stop_requested()) {
+                if (benchmark->IsComplete()) {
+                    benchmark->Stop();
+                    emu_window->RequestClose();
+                    return;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        });
+    }
+
     void(system.Run());
     if (system.DebuggerEnabled()) {
         system.InitializeDebugger();
     }
+    if (play_tas) {
+        input_subsystem.GetTas()->StartStop();
+    }
     while (emu_window->IsOpen()) {
         emu_window->WaitEvent();
     }
+
+    bool benchmark_failed = false;
+    if (benchmark) {
+        benchmark_watcher.request_stop();
+        benchmark_watcher.join();
+        benchmark->Stop();
+        benchmark_failed = !benchmark->WriteReport();
+    }
     system.DetachDebugger();
     void(system.Pause());
     system.ShutdownMainProcess();
@@ -455,5 +536,5 @@ int main(int argc, char** argv) {
 #endif
 
     detached_tasks.WaitForAllTasks();
-    return 0;
+    return benchmark_failed ? -1 : 0;
 }
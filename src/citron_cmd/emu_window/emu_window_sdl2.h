@@ -33,6 +33,9 @@ public:
     /// Wait for the next event on the main thread.
     void WaitEvent();
 
+    /// Asks the main thread to close the window. Can be called from any thread.
+    void RequestClose();
+
     // Sets the window icon from citron.bmp
     void SetWindowIcon();
 
@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "common/fs/fs_util.h"
+#include "common/fs/mapped_file.h"
+#include "common/logging/log.h"
+
+namespace Common::FS {
+
+MappedFile::MappedFile() = default;
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    Open(path);
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data{std::exchange(other.data, nullptr)}, size{std::exchange(other.size, 0)},
+      is_open{std::exchange(other.is_open, false)} {
+#ifdef _WIN32
+    mapping_handle = std::exchange(other.mapping_handle, nullptr);
+#endif
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+        is_open = std::exchange(other.is_open, false);
+#ifdef _WIN32
+        mapping_handle = std::exchange(other.mapping_handle, nullptr);
+#endif
+    }
+    return *this;
+}
+
+bool MappedFile::Open(const std::filesystem::path& path) {
+    Close();
+
+#ifdef _WIN32
+    const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE,
+                                    nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        LOG_ERROR(Common_Filesystem, "Failed to open the file at path={}, ec_message={}",
+                  PathToUTF8String(path), GetLastError());
+        return false;
+    }
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size)) {
+        CloseHandle(file);
+        return false;
+    }
+    if (file_size.QuadPart == 0) {
+        CloseHandle(file);
+        is_open = true;
+        return true;
+    }
+    const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        LOG_ERROR(Common_Filesystem, "Failed to map the file at path={}, ec_message={}",
+                  PathToUTF8String(path), GetLastError());
+        return false;
+    }
+    void* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        LOG_ERROR(Common_Filesystem, "Failed to map the file at path={}, ec_message={}",
+                  PathToUTF8String(path), GetLastError());
+        CloseHandle(mapping);
+        return false;
+    }
+    mapping_handle = mapping;
+    data = static_cast<const u8*>(view);
+    size = static_cast<size_t>(file_size.QuadPart);
+#else
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) {
+        LOG_ERROR(Common_Filesystem, "Failed to open the file at path={}, ec_message={}",
+                  PathToUTF8String(path), std::strerror(errno));
+        return false;
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0) {
+        close(fd);
+        return false;
+    }
+    if (file_stat.st_size == 0) {
+        close(fd);
+        is_open = true;
+        return true;
+    }
+    const size_t file_size = static_cast<size_t>(file_stat.st_size);
+    void* const view = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps its own reference to the file
+    close(fd);
+    if (view == MAP_FAILED) {
+        LOG_ERROR(Common_Filesystem, "Failed to map the file at path={}, ec_message={}",
+                  PathToUTF8String(path), std::strerror(errno));
+        return false;
+    }
+    data = static_cast<const u8*>(view);
+    size = file_size;
+#endif
+
+    is_open = true;
+    return true;
+}
+
+void MappedFile::Close() {
+    if (data != nullptr) {
+#ifdef _WIN32
+        UnmapViewOfFile(data);
+        CloseHandle(mapping_handle);
+        mapping_handle = nullptr;
+#else
+        munmap(const_cast<u8*>(data), size);
+#endif
+    }
+    data = nullptr;
+    size = 0;
+    is_open = false;
+}
+
+} // namespace Common::FS
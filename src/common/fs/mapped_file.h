@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <span>
+
+#include "common/common_types.h"
+
+namespace Common::FS {
+
+/**
+ * Read-only memory mapping of a whole file.
+ * Reads through the mapping are served from the page cache without copying the data into an
+ * intermediate buffer. Changes made to the file while it is mapped may or may not be visible.
+ */
+class MappedFile {
+public:
+    MappedFile();
+
+    /**
+     * Maps the file at path.
+     *
+     * @param path Filesystem path
+     */
+    explicit MappedFile(const std::filesystem::path& path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * Maps the file at path, unmapping the previously mapped file first.
+     * Empty files are opened successfully with an empty mapping.
+     *
+     * @param path Filesystem path
+     *
+     * @returns True if the file was mapped, false otherwise.
+     */
+    bool Open(const std::filesystem::path& path);
+
+    /// Unmaps the file, if it is mapped.
+    void Close();
+
+    /// Returns true if a file is mapped.
+    [[nodiscard]] bool IsOpen() const {
+        return is_open;
+    }
+
+    /// Returns the contents of the mapped file.
+    [[nodiscard]] std::span<const u8> Data() const {
+        return {data, size};
+    }
+
+    /// Returns the size of the mapped file in bytes.
+    [[nodiscard]] size_t Size() const {
+        return size;
+    }
+
+private:
+    const u8* data{};
+    size_t size{};
+    bool is_open{};
+#ifdef _WIN32
+    void* mapping_handle{};
+#endif
+};
+
+} // namespace Common::FS
@@ -211,6 +211,9 @@ struct Values {
                                              true,
                                              true,
                                              &use_speed_limit};
+    // Number of host threads handling the requests of each service process running on the host
+    Setting<u8, true> service_host_threads{
+        linkage, 1, 1, 8, "service_host_threads", Category::Core};
 
     // Cpu
     SwitchableSetting<CpuBackend, true> cpu_backend{linkage,
@@ -277,6 +280,10 @@ struct Values {
 
     SwitchableSetting<bool> use_disk_shader_cache{linkage, true, "use_disk_shader_cache",
                                                   Category::Renderer};
+    SwitchableSetting<bool> use_background_pipeline_loading{
+        linkage, true, "use_background_pipeline_loading", Category::Renderer};
+    SwitchableSetting<bool> use_disk_texture_cache{linkage, false, "use_disk_texture_cache",
+                                                   Category::Renderer};
     SwitchableSetting<bool> use_asynchronous_gpu_emulation{
         linkage, true, "use_asynchronous_gpu_emulation", Category::Renderer};
     SwitchableSetting<bool> respect_present_interval_zero{
@@ -410,6 +417,8 @@ struct Values {
 #endif
                                                   "use_reactive_flushing",
                                                   Category::RendererAdvanced};
+    SwitchableSetting<bool> use_predictive_downloads{linkage, false, "use_predictive_downloads",
+                                                     Category::RendererAdvanced};
     SwitchableSetting<bool> use_asynchronous_shaders{linkage, false, "use_asynchronous_shaders",
                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> use_fast_gpu_time{
@@ -573,6 +582,12 @@ struct Values {
                                         Category::DataStorage};
     Setting<std::string> gamecard_path{linkage, std::string(), "gamecard_path",
                                        Category::DataStorage};
+    // Memory budget in MiB of the cache of decrypted NCA blocks, 0 disables the cache
+    Setting<u16, true> nca_block_cache_size{
+        linkage, 64, 0, 1024, "nca_block_cache_size", Category::DataStorage};
+    // Check NCA RomFS blocks against their hierarchical SHA-256 hashes the first time they are read
+    Setting<bool> verify_nca_integrity{linkage, false, "verify_nca_integrity",
+                                       Category::DataStorage};
 
     // Debugging
     bool record_frame_times;
@@ -589,6 +604,14 @@ struct Values {
     Setting<bool> enable_fs_access_log{linkage, false, "enable_fs_access_log", Category::Debugging};
     Setting<bool> reporting_services{
         linkage, false, "reporting_services", Category::Debugging, Specialization::Default, false};
+    Setting<bool> record_service_statistics{linkage,
+                                            false,
+                                            "record_service_statistics",
+                                            Category::Debugging,
+                                            Specialization::Default,
+                                            false};
+    Setting<bool> profile_guest_code{
+        linkage, false, "profile_guest_code", Category::Debugging, Specialization::Default, false};
     Setting<bool> quest_flag{linkage, false, "quest_flag", Category::Debugging};
     Setting<bool> disable_macro_jit{linkage, false, "disable_macro_jit",
                                     Category::DebuggingGraphics};
@@ -7,6 +7,9 @@
 
 namespace Common {
 
+/// Hints the processor that the calling thread is spin waiting.
+void ThreadPause();
+
 /**
  * SpinLock class
  * a lock similar to mutex that forces a thread to spin wait instead calling the
@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+
+#include "common/common_types.h"
+#include "common/polyfill_thread.h"
+#include "common/spin_lock.h"
+
+namespace Common {
+
+/**
+ * Fixed capacity single producer single consumer ring.
+ *
+ * Elements are stored inline and both sides are lock free. A side that has to wait spins for a
+ * short while before parking on an atomic wait, and the other side issues a single wake up when it
+ * sees the waiter parked, so a busy ring never enters the kernel.
+ *
+ * @tparam T        Element type
+ * @tparam Capacity Number of slots, must be a power of two
+ */
+template <typename T, size_t Capacity = 0x1000>
+class SPSCRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two.");
+
+public:
+    /// Number of polls before a waiting side parks
+    static constexpr size_t SPIN_COUNT = 1024;
+
+    /// Spinning only delays the other side when it cannot run in parallel
+    [[nodiscard]] static size_t SpinCount() {
+        static const size_t spin_count = std::thread::hardware_concurrency() > 1 ? SPIN_COUNT : 0;
+        return spin_count;
+    }
+
+    template <typename... Args>
+    bool TryEmplace(Args&&... args) {
+        const size_t write_index = m_write_index.load(std::memory_order_relaxed);
+        if (!HasSpace(write_index)) {
+            return false;
+        }
+        Push(write_index, std::forward<Args>(args)...);
+        return true;
+    }
+
+    template <typename... Args>
+    void EmplaceWait(Args&&... args) {
+        const size_t write_index = m_write_index.load(std::memory_order_relaxed);
+        const size_t spin_count = SpinCount();
+        for (size_t spin = 0; !HasSpace(write_index); ++spin) {
+            if (spin < spin_count) {
+                ThreadPause();
+                continue;
+            }
+            // Park until the consumer frees a slot
+            const u32 epoch = m_producer_wake.load(std::memory_order_acquire);
+            m_producer_parked.store(true, std::memory_order_seq_cst);
+            if (!HasSpace(write_index)) {
+                m_producer_wake.wait(epoch, std::memory_order_acquire);
+            }
+            m_producer_parked.store(false, std::memory_order_relaxed);
+        }
+        Push(write_index, std::forward<Args>(args)...);
+    }
+
+    bool TryPop(T& t) {
+        const size_t read_index = m_read_index.load(std::memory_order_relaxed);
+        if (!HasData(read_index)) {
+            return false;
+        }
+        Pop(read_index, t);
+        return true;
+    }
+
+    /// Pops an element, waiting for one to be pushed.
+    /// @returns False when a stop was requested before an element was available
+    bool PopWait(T& t, std::stop_token stop_token) {
+        const size_t read_index = m_read_index.load(std::memory_order_relaxed);
+        const size_t spin_count = SpinCount();
+        for (size_t spin = 0; spin < spin_count; ++spin) {
+            if (HasData(read_index)) {
+                Pop(read_index, t);
+                return true;
+            }
+            ThreadPause();
+        }
+        // Park until the producer pushes or a stop is requested
+        std::stop_callback callback{stop_token, [this] { Wake(m_consumer_wake); }};
+        while (!HasData(read_index)) {
+            const u32 epoch = m_consumer_wake.load(std::memory_order_acquire);
+            m_consumer_parked.store(true, std::memory_order_seq_cst);
+            if (stop_token.stop_requested()) {
+                m_consumer_parked.store(false, std::memory_order_relaxed);
+                return false;
+            }
+            if (!HasData(read_index)) {
+                m_consumer_wake.wait(epoch, std::memory_order_acquire);
+            }
+            m_consumer_parked.store(false, std::memory_order_relaxed);
+        }
+        Pop(read_index, t);
+        return true;
+    }
+
+    [[nodiscard]] size_t Size() const {
+        return m_write_index.load(std::memory_order_acquire) -
+               m_read_index.load(std::memory_order_acquire);
+    }
+
+private:
+    static void Wake(std::atomic<u32>& wake) {
+        wake.fetch_add(1, std::memory_order_release);
+        wake.notify_one();
+    }
+
+    bool HasSpace(size_t write_index) {
+        if (write_index - m_cached_read_index < Capacity) {
+            return true;
+        }
+        m_cached_read_index = m_read_index.load(std::memory_order_seq_cst);
+        return write_index - m_cached_read_index < Capacity;
+    }
+
+    bool HasData(size_t read_index) {
+        if (read_index != m_cached_write_index) {
+            return true;
+        }
+        m_cached_write_index = m_write_index.load(std::memory_order_seq_cst);
+        return read_index != m_cached_write_index;
+    }
+
+    template <typename... Args>
+    void Push(size_t write_index, Args&&... args) {
+        m_data[write_index % Capacity] = T(std::forward<Args>(args)...);
+        // Publishing and checking for a parked consumer must not be reordered
+        m_write_index.store(write_index + 1, std::memory_order_seq_cst);
+        if (m_consumer_parked.load(std::memory_order_seq_cst) &&
+            m_consumer_parked.exchange(false, std::memory_order_acq_rel)) {
+            Wake(m_consumer_wake);
+        }
+    }
+
+    void Pop(size_t read_index, T& t) {
+        t = std::move(m_data[read_index % Capacity]);
+        m_read_index.store(read_index + 1, std::memory_order_seq_cst);
+        if (m_producer_parked.load(std::memory_order_seq_cst) &&
+            m_producer_parked.exchange(false, std::memory_order_acq_rel)) {
+            Wake(m_producer_wake);
+        }
+    }
+
+    // Each side owns a cache line for its index and its copy of the other side's index, and the
+    // park state lives apart so that checking it does not false share with the indices.
+    alignas(128) std::atomic_size_t m_write_index{0};
+    size_t m_cached_read_index{0};
+
+    alignas(128) std::atomic_size_t m_read_index{0};
+    size_t m_cached_write_index{0};
+
+    alignas(128) std::atomic_bool m_producer_parked{false};
+    std::atomic<u32> m_producer_wake{0};
+
+    alignas(128) std::atomic_bool m_consumer_parked{false};
+    std::atomic<u32> m_consumer_wake{0};
+
+    alignas(128) std::array<T, Capacity> m_data{};
+};
+
+} // namespace Common
@@ -79,6 +79,8 @@ constexpr std::array<u64, 2> SegmentBases{
     0x7100000000ULL,
 };
 
+} // namespace
+
 void SymbolicateBacktrace(Kernel::KProcess* process, std::vector<BacktraceEntry>& out) {
     auto modules = FindModules(process);
 
@@ -118,6 +120,8 @@ void SymbolicateBacktrace(Kernel::KProcess* process, std::vector<BacktraceEntry>
     }
 }
 
+namespace {
+
 std::vector<BacktraceEntry> GetAArch64Backtrace(Kernel::KProcess* process,
                                                 const Kernel::Svc::ThreadContext& ctx) {
     std::vector<BacktraceEntry> out;
@@ -28,6 +28,9 @@ struct BacktraceEntry {
     std::string name;
 };
 
+/// Fills in the module, offset and symbol name of entries with only an original address.
+void SymbolicateBacktrace(Kernel::KProcess* process, std::vector<BacktraceEntry>& out);
+
 std::vector<BacktraceEntry> GetBacktraceFromContext(Kernel::KProcess* process,
                                                     const Kernel::Svc::ThreadContext& ctx);
 std::vector<BacktraceEntry> GetBacktrace(const Kernel::KThread* thread);
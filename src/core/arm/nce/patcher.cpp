@@ -1,9 +1,21 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
 #include "common/arm64/native_clock.h"
 #include "common/bit_cast.h"
+#include "common/cityhash.h"
+#include "common/common_funcs.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/hex_util.h"
 #include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/scm_rev.h"
 #include "core/arm/nce/arm_nce.h"
 #include "core/arm/nce/guest_context.h"
 #include "core/arm/nce/instructions.h"
@@ -22,6 +34,56 @@ using NativeExecutionParameters = Kernel::KThread::NativeExecutionParameters;
 constexpr size_t MaxRelativeBranch = 128_MiB;
 constexpr u32 ModuleCodeIndex = 0x24 / sizeof(u32);
 
+namespace {
+
+constexpr u32 PatchCacheMagic = Common::MakeMagic('N', 'C', 'E', 'P');
+constexpr u32 PatchCacheVersion = 1;
+
+/// Header of a cached module patch, followed by its instructions, relocations, trampolines and
+/// exclusives.
+struct PatchCacheHeader {
+    u32 magic;
+    u32 version;
+    u64 revision_hash; ///< The generated code depends on the layout of the guest context
+    std::array<u64, 2> cntfrq_factor;
+    u64 text_hash;
+    u64 text_size;
+    u64 patch_start; ///< Position of the module patch in the patch section, in instructions
+    u64 num_instructions;
+    u64 num_branch_to_patch_relocations;
+    u64 num_branch_to_module_relocations;
+    u64 num_write_module_pc_relocations;
+    u64 num_trampolines;
+    u64 num_exclusives;
+    PatchStatistics statistics;
+    u32 reserved;
+};
+static_assert(std::is_trivially_copyable_v<PatchCacheHeader>);
+
+std::array<u64, 2> GetGuestCntfrqFactor() {
+    static Common::Arm64::NativeClock clock{};
+    return Common::BitCast<std::array<u64, 2>>(clock.GetGuestCNTFRQFactor());
+}
+
+u64 GetRevisionHash() {
+    return Common::CityHash64(Common::g_scm_rev, std::strlen(Common::g_scm_rev));
+}
+
+u64 GetTextHash(std::span<const u8> text) {
+    return Common::CityHash64(reinterpret_cast<const char*>(text.data()), text.size());
+}
+
+std::filesystem::path GetPatchCachePath(std::span<const u8> build_id) {
+    // Homebrew is often built without a build ID.
+    if (std::ranges::all_of(build_id, [](u8 byte) { return byte == 0; })) {
+        return {};
+    }
+    return Common::FS::GetCitronPath(Common::FS::CitronPath::CacheDir) / "nce" /
+           fmt::format("{}.bin", Common::HexToString(build_id));
+}
+
+} // Anonymous namespace
+
 Patcher::Patcher() : c(m_patch_instructions) {
     // The first word of the patch section is always a branch to the first instruction of the
     // module.
@@ -39,7 +101,7 @@ Patcher::Patcher() : c(m_patch_instructions) {
 Patcher::~Patcher() = default;
 
 bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
-                        const Kernel::CodeSet::Segment& code) {
+                        const Kernel::CodeSet::Segment& code, std::span<const u8> build_id) {
     // If we have patched modules but cannot reach the new module, then it needs its own patcher.
     const size_t image_size = program_image.size();
     if (total_program_size + image_size > MaxRelativeBranch && total_program_size > 0) {
@@ -50,12 +112,42 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
     modules.emplace_back();
     curr_patch = &modules.back();
 
+    // Retrieve text segment data.
+    const auto start_time = std::chrono::steady_clock::now();
+    const auto text = std::span{program_image}.subspan(code.offset, code.size);
+    const size_t patch_start = m_patch_instructions.size();
+    const auto cache_path = GetPatchCachePath(build_id);
+    const bool is_cached = !cache_path.empty() && LoadCachedPatch(cache_path, text, patch_start);
+    if (!is_cached) {
+        ScanText(text);
+        if (!cache_path.empty()) {
+            SaveCachedPatch(cache_path, text, patch_start);
+        }
+    }
+
+    const PatchStatistics& statistics = curr_patch->m_statistics;
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time);
+    LOG_INFO(Core_ARM,
+             "Patched {} KiB of code{} in {:.2f} ms: {} SVC, {} TPIDR MRS, {} TPIDR MSR, "
+             "{} CNTPCT, {} exclusives",
+             text.size() / 1_KiB, is_cached ? " from the cache" : "",
+             static_cast<double>(elapsed.count()) / 1000.0, statistics.svc, statistics.mrs_tls,
+             statistics.msr_tls, statistics.cntpct, statistics.exclusives);
+
+    // Determine patching mode for the final relocation step
+    total_program_size += image_size;
+    this->mode = image_size > MaxRelativeBranch ? PatchMode::PreText : PatchMode::PostData;
+    return true;
+}
+
+void Patcher::ScanText(std::span<const u8> text) {
+    PatchStatistics& statistics = curr_patch->m_statistics;
+
     // The first word of the patch section is always a branch to the first instruction of the
     // module.
     curr_patch->m_branch_to_module_relocations.push_back({0, 0});
 
-    // Retrieve text segment data.
-    const auto text = std::span{program_image}.subspan(code.offset, code.size);
     const auto text_words =
         std::span<const u32>{reinterpret_cast<const u32*>(text.data()), text.size() / sizeof(u32)};
 
@@ -77,6 +169,7 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
         // SVC
         if (auto svc = SVC{inst}; svc.Verify()) {
             WriteSvcTrampoline(AddRelocations(), svc.GetValue());
+            statistics.svc++;
             continue;
         }
 
@@ -88,12 +181,14 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
                                                                   : oaknut::SystemReg::TPIDR_EL0;
             const auto dest_reg = oaknut::XReg{static_cast<int>(mrs.GetRt())};
             WriteMrsHandler(AddRelocations(), dest_reg, src_reg);
+            statistics.mrs_tls++;
             continue;
         }
 
         // MRS Xn, CNTPCT_EL0
         if (auto mrs = MRS{inst}; mrs.Verify() && mrs.GetSystemReg() == CntpctEl0) {
             WriteCntpctHandler(AddRelocations(), oaknut::XReg{static_cast<int>(mrs.GetRt())});
+            statistics.cntpct++;
             continue;
         }
 
@@ -105,20 +200,112 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
         // MSR TPIDR_EL0, Xn
         if (auto msr = MSR{inst}; msr.Verify() && msr.GetSystemReg() == TpidrEl0) {
             WriteMsrHandler(AddRelocations(), oaknut::XReg{static_cast<int>(msr.GetRt())});
+            statistics.msr_tls++;
             continue;
         }
 
         if (auto exclusive = Exclusive{inst}; exclusive.Verify()) {
             curr_patch->m_exclusives.push_back(i);
+            statistics.exclusives++;
         }
     }
+}
 
-    // Determine patching mode for the final relocation step
-    total_program_size += image_size;
-    this->mode = image_size > MaxRelativeBranch ? PatchMode::PreText : PatchMode::PostData;
+bool Patcher::LoadCachedPatch(const std::filesystem::path& path, std::span<const u8> text,
+                              size_t patch_start) {
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Read,
+                            Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        return false;
+    }
+
+    PatchCacheHeader header{};
+    if (!file.ReadObject(header) || header.magic != PatchCacheMagic ||
+        header.version != PatchCacheVersion || header.revision_hash != GetRevisionHash() ||
+        header.cntfrq_factor != GetGuestCntfrqFactor() || header.text_size != text.size() ||
+        header.patch_start != patch_start || header.text_hash != GetTextHash(text)) {
+        return false;
+    }
+
+    const u64 file_size = file.GetSize();
+    const auto ReadVector = [&]<typename T>(std::vector<T>& out, u64 count) {
+        if (count > file_size / sizeof(T)) {
+            return false;
+        }
+        out.resize(count);
+        return file.ReadSpan<T>(out) == count;
+    };
+
+    std::vector<u32> instructions;
+    ModulePatch patch{};
+    if (!ReadVector(instructions, header.num_instructions) ||
+        !ReadVector(patch.m_branch_to_patch_relocations,
+                    header.num_branch_to_patch_relocations) ||
+        !ReadVector(patch.m_branch_to_module_relocations,
+                    header.num_branch_to_module_relocations) ||
+        !ReadVector(patch.m_write_module_pc_relocations, header.num_write_module_pc_relocations) ||
+        !ReadVector(patch.m_trampolines, header.num_trampolines) ||
+        !ReadVector(patch.m_exclusives, header.num_exclusives)) {
+        LOG_WARNING(Core_ARM, "Ignoring truncated NCE patch cache {}",
+                    Common::FS::PathToUTF8String(path));
+        return false;
+    }
+    patch.m_statistics = header.statistics;
+
+    m_patch_instructions.insert(m_patch_instructions.end(), instructions.begin(),
+                                instructions.end());
+    *curr_patch = std::move(patch);
     return true;
 }
 
+void Patcher::SaveCachedPatch(const std::filesystem::path& path, std::span<const u8> text,
+                              size_t patch_start) const {
+    void(Common::FS::CreateParentDirs(path));
+    Common::FS::IOFile file{path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::BinaryFile};
+    if (!file.IsOpen()) {
+        LOG_WARNING(Core_ARM, "Failed to open NCE patch cache {} for writing",
+                    Common::FS::PathToUTF8String(path));
+        return;
+    }
+
+    const auto instructions = std::span{m_patch_instructions}.subspan(patch_start);
+    const ModulePatch& patch = *curr_patch;
+    const PatchCacheHeader header{
+        .magic = PatchCacheMagic,
+        .version = PatchCacheVersion,
+        .revision_hash = GetRevisionHash(),
+        .cntfrq_factor = GetGuestCntfrqFactor(),
+        .text_hash = GetTextHash(text),
+        .text_size = text.size(),
+        .patch_start = patch_start,
+        .num_instructions = instructions.size(),
+        .num_branch_to_patch_relocations = patch.m_branch_to_patch_relocations.size(),
+        .num_branch_to_module_relocations = patch.m_branch_to_module_relocations.size(),
+        .num_write_module_pc_relocations = patch.m_write_module_pc_relocations.size(),
+        .num_trampolines = patch.m_trampolines.size(),
+        .num_exclusives = patch.m_exclusives.size(),
+        .statistics = patch.m_statistics,
+        .reserved = 0,
+    };
+
+    const auto WriteVector = [&]<typename T>(std::span<const T> data) {
+        return file.WriteSpan(data) == data.size();
+    };
+    const bool is_written =
+        file.WriteObject(header) && WriteVector(instructions) &&
+        WriteVector(std::span{patch.m_branch_to_patch_relocations}) &&
+        WriteVector(std::span{patch.m_branch_to_module_relocations}) &&
+        WriteVector(std::span{patch.m_write_module_pc_relocations}) &&
+        WriteVector(std::span{patch.m_trampolines}) && WriteVector(std::span{patch.m_exclusives});
+    if (!is_written) {
+        file.Close();
+        void(Common::FS::RemoveFile(path));
+        LOG_WARNING(Core_ARM, "Failed to write NCE patch cache {}",
+                    Common::FS::PathToUTF8String(path));
+    }
+}
+
 bool Patcher::RelocateAndCopy(Common::ProcessAddress load_base,
                               const Kernel::CodeSet::Segment& code,
                               Kernel::PhysicalMemory& program_image,
@@ -412,9 +599,7 @@ void Patcher::WriteMsrHandler(ModuleDestLabel module_dest, oaknut::XReg src_reg)
 }
 
 void Patcher::WriteCntpctHandler(ModuleDestLabel module_dest, oaknut::XReg dest_reg) {
-    static Common::Arm64::NativeClock clock{};
-    const auto factor = clock.GetGuestCNTFRQFactor();
-    const auto raw_factor = Common::BitCast<std::array<u64, 2>>(factor);
+    const auto raw_factor = GetGuestCntfrqFactor();
 
     const auto use_x2_x3 = dest_reg.index() == 0 || dest_reg.index() == 1;
     oaknut::XReg scratch0 = use_x2_x3 ? X2 : X0;
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <filesystem>
 #include <span>
 #include <unordered_map>
 #include <vector>
@@ -22,6 +23,15 @@ enum class PatchMode : u32 {
     PostData, ///< Patch section is inserted after .data
 };
 
+/// Number of instructions of a module that were patched, by kind.
+struct PatchStatistics {
+    u32 svc{};
+    u32 mrs_tls{};
+    u32 msr_tls{};
+    u32 cntpct{};
+    u32 exclusives{};
+};
+
 using ModuleTextAddress = u64;
 using PatchTextAddress = u64;
 using EntryTrampolines = std::unordered_map<ModuleTextAddress, PatchTextAddress>;
@@ -31,8 +41,10 @@ public:
     explicit Patcher();
     ~Patcher();
 
+    /// Patches the text of a module. When a build ID is given, the patch is reused from the
+    /// cache directory if this module was patched at the same position before.
     bool PatchText(const Kernel::PhysicalMemory& program_image,
-                   const Kernel::CodeSet::Segment& code);
+                   const Kernel::CodeSet::Segment& code, std::span<const u8> build_id = {});
     bool RelocateAndCopy(Common::ProcessAddress load_base, const Kernel::CodeSet::Segment& code,
                          Kernel::PhysicalMemory& program_image, EntryTrampolines* out_trampolines);
     size_t GetSectionSize() const noexcept;
@@ -49,6 +61,12 @@ private:
         uintptr_t module_offset;
     };
 
+    void ScanText(std::span<const u8> text);
+    bool LoadCachedPatch(const std::filesystem::path& path, std::span<const u8> text,
+                         size_t patch_start);
+    void SaveCachedPatch(const std::filesystem::path& path, std::span<const u8> text,
+                         size_t patch_start) const;
+
     void WriteLoadContext();
     void WriteSaveContext();
     void LockContext();
@@ -90,6 +108,7 @@ private:
         std::vector<Relocation> m_branch_to_module_relocations{};
         std::vector<Relocation> m_write_module_pc_relocations{};
         std::vector<ModuleTextAddress> m_exclusives{};
+        PatchStatistics m_statistics{};
     };
 
     oaknut::VectorCodeGenerator c;
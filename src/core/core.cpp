@@ -46,6 +46,7 @@
 #include "core/hle/service/psc/time/system_clock.h"
 #include "core/hle/service/psc/time/time_zone_service.h"
 #include "core/hle/service/service.h"
+#include "core/hle/service/service_statistics.h"
 #include "core/hle/service/services.h"
 #include "core/hle/service/set/system_settings_server.h"
 #include "core/hle/service/sm/sm.h"
@@ -57,6 +58,7 @@
 #include "core/reporter.h"
 #include "core/telemetry_session.h"
 #include "core/tools/freezer.h"
+#include "core/tools/guest_profiler.h"
 #include "core/tools/renderdoc.h"
 #include "hid_core/hid_core.h"
 #include "network/network.h"
@@ -299,6 +301,11 @@ struct System::Impl {
             renderdoc_api = std::make_unique<Tools::RenderdocAPI>();
         }
 
+        if (Settings::values.profile_guest_code) {
+            guest_profiler = std::make_unique<Tools::GuestProfiler>(system);
+            guest_profiler->Start();
+        }
+
         LOG_DEBUG(Core, "Initialized OK");
 
         return SystemResultStatus::Success;
@@ -424,12 +431,24 @@ struct System::Impl {
             gpu_core->NotifyShutdown();
         }
 
+        if (guest_profiler) {
+            guest_profiler->Stop();
+        }
+
         stop_event.request_stop();
         core_timing.SyncPause(false);
         Network::CancelPendingSocketOperations();
         kernel.SuspendEmulation(true);
         kernel.CloseServices();
         kernel.ShutdownCores();
+        if (Settings::values.record_service_statistics) {
+            service_statistics.Dump();
+            service_statistics.Clear();
+        }
+        if (guest_profiler) {
+            guest_profiler->Dump();
+            guest_profiler.reset();
+        }
         services.reset();
         service_manager.reset();
         fs_controller.Reset();
@@ -534,6 +553,12 @@ struct System::Impl {
     /// Services
     std::unique_ptr<Service::Services> services;
 
+    /// Statistics of the service commands, recorded while enabled in the settings
+    Service::ServiceStatistics service_statistics;
+
+    /// Sampling profiler of the guest code, created while enabled in the settings
+    std::unique_ptr<Tools::GuestProfiler> guest_profiler;
+
     /// Telemetry session for this emulation session
     std::unique_ptr<Core::TelemetrySession> telemetry_session;
 
@@ -983,6 +1008,14 @@ Tools::RenderdocAPI& System::GetRenderdocAPI() {
     return *impl->renderdoc_api;
 }
 
+Service::ServiceStatistics& System::GetServiceStatistics() {
+    return impl->service_statistics;
+}
+
+Tools::GuestProfiler* System::GetGuestProfiler() {
+    return impl->guest_profiler.get();
+}
+
 void System::RunServer(std::unique_ptr<Service::ServerManager>&& server_manager) {
     return impl->kernel.RunServer(std::move(server_manager));
 }
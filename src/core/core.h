@@ -73,6 +73,7 @@ class ARPManager;
 }
 
 class ServerManager;
+class ServiceStatistics;
 
 namespace SM {
 class ServiceManager;
@@ -109,8 +110,9 @@ class RoomNetwork;
 }
 
 namespace Tools {
+class GuestProfiler;
 class RenderdocAPI;
-}
+} // namespace Tools
 
 namespace Core {
 
@@ -395,6 +397,12 @@ public:
 
     [[nodiscard]] Tools::RenderdocAPI& GetRenderdocAPI();
 
+    /// Gets the call statistics of the HLE service commands.
+    [[nodiscard]] Service::ServiceStatistics& GetServiceStatistics();
+
+    /// Gets the guest code profiler, or nullptr if it was not enabled when emulation started.
+    [[nodiscard]] Tools::GuestProfiler* GetGuestProfiler();
+
     void SetExitLocked(bool locked);
     bool GetExitLocked() const;
 
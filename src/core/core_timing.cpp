@@ -27,22 +27,23 @@ std::shared_ptr<EventType> CreateEvent(std::string name, TimedCallback&& callbac
 }
 
 struct CoreTiming::Event {
-    s64 time;
-    u64 fifo_order;
     std::weak_ptr<EventType> type;
+    /// Identity of the event type, compared when unscheduling so that the weak pointer does not
+    /// have to be locked for every pending event. Null while the slot is free.
+    const EventType* type_ptr;
     s64 reschedule_time;
-    heap_t::handle_type handle{};
+    u32 queue_position;
+};
 
-    // Sort by time, unless the times are the same, in which case sort by
-    // the order added to the queue
-    friend bool operator>(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) > std::tie(right.time, right.fifo_order);
-    }
+namespace {
 
-    friend bool operator<(const Event& left, const Event& right) {
-        return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
-    }
-};
+constexpr size_t QUEUE_ARITY = 4;
+
+bool EarlierThan(const auto& left, const auto& right) {
+    return std::tie(left.time, left.fifo_order) < std::tie(right.time, right.fifo_order);
+}
+
+} // Anonymous namespace
 
 CoreTiming::CoreTiming() : clock{Common::CreateOptimalClock()} {}
 
@@ -73,6 +74,8 @@ void CoreTiming::Initialize(std::function<void()>&& on_thread_init_) {
 
 void CoreTiming::ClearPendingEvents() {
     std::scoped_lock lock{advance_lock, basic_lock};
+    events.clear();
+    free_events.clear();
     event_queue.clear();
     event.Set();
 }
@@ -117,31 +120,33 @@ bool CoreTiming::HasPendingEvents() const {
 
 void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
                                const std::shared_ptr<EventType>& event_type, bool absolute_time) {
+    const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
+    bool is_next_event;
     {
         std::scoped_lock scope{basic_lock};
-        const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
-
-        auto h{event_queue.emplace(Event{next_time.count(), event_fifo_id++, event_type, 0})};
-        (*h).handle = h;
+        is_next_event = PushEvent(next_time.count(), event_type, 0);
     }
 
-    event.Set();
+    // The timer thread only needs to wake up if its current deadline moved forward.
+    if (is_next_event) {
+        event.Set();
+    }
 }
 
 void CoreTiming::ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
                                       std::chrono::nanoseconds resched_time,
                                       const std::shared_ptr<EventType>& event_type,
                                       bool absolute_time) {
+    const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
+    bool is_next_event;
     {
         std::scoped_lock scope{basic_lock};
-        const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
-
-        auto h{event_queue.emplace(
-            Event{next_time.count(), event_fifo_id++, event_type, resched_time.count()})};
-        (*h).handle = h;
+        is_next_event = PushEvent(next_time.count(), event_type, resched_time.count());
     }
 
-    event.Set();
+    if (is_next_event) {
+        event.Set();
+    }
 }
 
 void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
@@ -149,18 +154,12 @@ void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
     {
         std::scoped_lock lk{basic_lock};
 
-        std::vector<heap_t::handle_type> to_remove;
-        for (auto itr = event_queue.begin(); itr != event_queue.end(); itr++) {
-            const Event& e = *itr;
-            if (e.type.lock().get() == event_type.get()) {
-                to_remove.push_back(itr->handle);
+        for (u32 i = 0; i < static_cast<u32>(events.size()); i++) {
+            if (events[i].type_ptr == event_type.get()) {
+                RemoveEvent(i);
             }
         }
 
-        for (auto& h : to_remove) {
-            event_queue.erase(h);
-        }
-
         event_type->sequence_number++;
     }
 
@@ -201,15 +200,17 @@ std::optional<s64> CoreTiming::Advance() {
     std::scoped_lock lock{advance_lock, basic_lock};
     global_timer = GetGlobalTimeNs().count();
 
-    while (!event_queue.empty() && event_queue.top().time <= global_timer) {
-        const Event& evt = event_queue.top();
+    while (!event_queue.empty() && event_queue.front().time <= global_timer) {
+        const QueueEntry evt = event_queue.front();
+        const u32 evt_index = evt.event_index;
 
-        if (const auto event_type{evt.type.lock()}) {
+        if (const auto event_type{events[evt_index].type.lock()}) {
             const auto evt_time = evt.time;
             const auto evt_sequence_num = event_type->sequence_number;
+            const auto reschedule_time = events[evt_index].reschedule_time;
 
-            if (evt.reschedule_time == 0) {
-                event_queue.pop();
+            if (reschedule_time == 0) {
+                RemoveEvent(evt_index);
 
                 basic_lock.unlock();
 
@@ -226,31 +227,34 @@ std::optional<s64> CoreTiming::Advance() {
                 basic_lock.lock();
 
                 if (evt_sequence_num != event_type->sequence_number) {
-                    // Heap handle is invalidated after external modification.
+                    // The event was unscheduled by the callback or another thread.
                     continue;
                 }
 
                 const auto next_schedule_time{new_schedule_time.has_value()
                                                   ? new_schedule_time.value().count()
-                                                  : evt.reschedule_time};
+                                                  : reschedule_time};
 
                 // If this event was scheduled into a pause, its time now is going to be way
                 // behind. Re-set this event to continue from the end of the pause.
-                auto next_time{evt.time + next_schedule_time};
-                if (evt.time < pause_end_time) {
+                auto next_time{evt_time + next_schedule_time};
+                if (evt_time < pause_end_time) {
                     next_time = pause_end_time + next_schedule_time;
                 }
 
-                event_queue.update(evt.handle, Event{next_time, event_fifo_id++, evt.type,
-                                                     next_schedule_time, evt.handle});
+                events[evt_index].reschedule_time = next_schedule_time;
+                RescheduleEvent(evt_index, next_time);
             }
+        } else {
+            // The event type was destroyed, nothing is left to call.
+            RemoveEvent(evt_index);
         }
 
         global_timer = GetGlobalTimeNs().count();
     }
 
     if (!event_queue.empty()) {
-        return event_queue.top().time;
+        return event_queue.front().time;
     } else {
         return std::nullopt;
     }
@@ -301,6 +305,99 @@ void CoreTiming::ThreadLoop() {
     }
 }
 
+bool CoreTiming::PushEvent(s64 time, const std::shared_ptr<EventType>& event_type,
+                           s64 reschedule_time) {
+    u32 event_index;
+    if (free_events.empty()) {
+        event_index = static_cast<u32>(events.size());
+        events.emplace_back();
+    } else {
+        event_index = free_events.back();
+        free_events.pop_back();
+    }
+    events[event_index] = Event{event_type, event_type.get(), reschedule_time, 0};
+
+    const size_t position = event_queue.size();
+    event_queue.emplace_back();
+    PlaceQueueEntry(position, QueueEntry{time, event_fifo_id++, event_index});
+    SiftUp(position);
+    return event_queue.front().event_index == event_index;
+}
+
+void CoreTiming::RescheduleEvent(u32 event_index, s64 time) {
+    const size_t position = events[event_index].queue_position;
+    const QueueEntry old_entry = event_queue[position];
+    event_queue[position].time = time;
+    event_queue[position].fifo_order = event_fifo_id++;
+    if (EarlierThan(event_queue[position], old_entry)) {
+        SiftUp(position);
+    } else {
+        SiftDown(position);
+    }
+}
+
+void CoreTiming::RemoveEvent(u32 event_index) {
+    Event& evt = events[event_index];
+    const size_t position = evt.queue_position;
+    const QueueEntry last = event_queue.back();
+    event_queue.pop_back();
+    if (position < event_queue.size()) {
+        const QueueEntry removed = event_queue[position];
+        PlaceQueueEntry(position, last);
+        if (EarlierThan(last, removed)) {
+            SiftUp(position);
+        } else {
+            SiftDown(position);
+        }
+    }
+
+    evt.type.reset();
+    evt.type_ptr = nullptr;
+    free_events.push_back(event_index);
+}
+
+void CoreTiming::PlaceQueueEntry(size_t position, const QueueEntry& entry) {
+    event_queue[position] = entry;
+    events[entry.event_index].queue_position = static_cast<u32>(position);
+}
+
+void CoreTiming::SiftUp(size_t position) {
+    const QueueEntry entry = event_queue[position];
+    while (position > 0) {
+        const size_t parent = (position - 1) / QUEUE_ARITY;
+        if (!EarlierThan(entry, event_queue[parent])) {
+            break;
+        }
+        PlaceQueueEntry(position, event_queue[parent]);
+        position = parent;
+    }
+    PlaceQueueEntry(position, entry);
+}
+
+void CoreTiming::SiftDown(size_t position) {
+    const QueueEntry entry = event_queue[position];
+    const size_t size = event_queue.size();
+    while (true) {
+        const size_t first_child = position * QUEUE_ARITY + 1;
+        if (first_child >= size) {
+            break;
+        }
+        size_t earliest = first_child;
+        const size_t last_child = std::min(first_child + QUEUE_ARITY, size);
+        for (size_t child = first_child + 1; child < last_child; child++) {
+            if (EarlierThan(event_queue[child], event_queue[earliest])) {
+                earliest = child;
+            }
+        }
+        if (!EarlierThan(event_queue[earliest], entry)) {
+            break;
+        }
+        PlaceQueueEntry(position, event_queue[earliest]);
+        position = earliest;
+    }
+    PlaceQueueEntry(position, entry);
+}
+
 void CoreTiming::Reset() {
     paused = true;
     shutting_down = true;
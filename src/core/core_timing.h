@@ -11,8 +11,7 @@
 #include <optional>
 #include <string>
 #include <thread>
-
-#include <boost/heap/fibonacci_heap.hpp>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/thread.h"
@@ -141,11 +140,30 @@ public:
 private:
     struct Event;
 
+    /// Ordering key of a pending event. The queue only holds these keys, so sifting touches a
+    /// small contiguous array and never the events themselves.
+    struct QueueEntry {
+        s64 time;
+        u64 fifo_order;
+        u32 event_index;
+    };
+
     static void ThreadEntry(CoreTiming& instance);
     void ThreadLoop();
 
     void Reset();
 
+    /// Adds an event to the queue and returns whether it is now the next event to fire.
+    bool PushEvent(s64 time, const std::shared_ptr<EventType>& event_type, s64 reschedule_time);
+    /// Moves a pending event to a new time, keeping its index in the event pool.
+    void RescheduleEvent(u32 event_index, s64 time);
+    /// Removes a pending event from the queue and returns its slot to the pool.
+    void RemoveEvent(u32 event_index);
+
+    void PlaceQueueEntry(size_t position, const QueueEntry& entry);
+    void SiftUp(size_t position);
+    void SiftDown(size_t position);
+
     std::unique_ptr<Common::WallClock> clock;
 
     s64 global_timer = 0;
@@ -154,10 +172,12 @@ private:
     s64 timer_resolution_ns;
 #endif
 
-    using heap_t =
-        boost::heap::fibonacci_heap<CoreTiming::Event, boost::heap::compare<std::greater<>>>;
-
-    heap_t event_queue;
+    /// Pool of scheduled events. Indices stay valid until the event is removed, including
+    /// across reschedules of looping events.
+    std::vector<Event> events;
+    std::vector<u32> free_events;
+    /// 4-ary min-heap of the pending events, ordered by time and then by scheduling order.
+    std::vector<QueueEntry> event_queue;
     u64 event_fifo_id = 0;
 
     Common::Event event{};
@@ -0,0 +1,431 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/auxv.h>
+#endif
+#endif
+
+#include "common/assert.h"
+#include "common/swap.h"
+#include "core/crypto/aes_hw.h"
+
+#if defined(ARCHITECTURE_x86_64) && !defined(_MSC_VER)
+#define TARGET_AES __attribute__((target("aes")))
+#elif defined(ARCHITECTURE_arm64) && defined(__clang__)
+#define TARGET_AES __attribute__((target("aes")))
+#elif defined(ARCHITECTURE_arm64) && defined(__GNUC__)
+#define TARGET_AES __attribute__((target("+crypto")))
+#else
+#define TARGET_AES
+#endif
+
+#if defined(ARCHITECTURE_arm64) && defined(__linux__) && !defined(HWCAP_AES)
+#define HWCAP_AES (1 << 3)
+#endif
+
+namespace Core::Crypto::AESHW {
+
+namespace {
+
+/// Multiplies in GF(2^8) modulo the AES polynomial.
+constexpr u8 Multiply(u8 a, u8 b) {
+    u8 product = 0;
+    for (; b != 0; b >>= 1) {
+        if ((b & 1) != 0) {
+            product ^= a;
+        }
+        a = static_cast<u8>((a << 1) ^ ((a & 0x80) != 0 ? 0x1B : 0));
+    }
+    return product;
+}
+
+constexpr u8 RotateLeft(u8 value, int shift) {
+    return static_cast<u8>((value << shift) | (value >> (8 - shift)));
+}
+
+/// Builds the S-box from the multiplicative inverse and the affine transform.
+constexpr std::array<u8, 256> MakeSBox() {
+    std::array<u8, 256> sbox{};
+    for (u32 x = 0; x < 256; ++x) {
+        // x^254 is the inverse of x, and maps 0 to 0
+        u8 inverse = 1;
+        u8 power = static_cast<u8>(x);
+        for (u32 exponent = 254; exponent != 0; exponent >>= 1) {
+            if ((exponent & 1) != 0) {
+                inverse = Multiply(inverse, power);
+            }
+            power = Multiply(power, power);
+        }
+        sbox[x] = static_cast<u8>(inverse ^ RotateLeft(inverse, 1) ^ RotateLeft(inverse, 2) ^
+                                  RotateLeft(inverse, 3) ^ RotateLeft(inverse, 4) ^ 0x63);
+    }
+    return sbox;
+}
+
+constexpr std::array<u8, 256> SBOX = MakeSBox();
+static_assert(SBOX[0x00] == 0x63 && SBOX[0x01] == 0x7C && SBOX[0x53] == 0xED);
+
+constexpr std::array<u8, 10> RCON{0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36};
+
+/// Number of blocks in flight, enough to cover the latency of the AES instructions
+constexpr std::size_t LANES = 8;
+
+using Tweak = std::array<u64, 2>;
+
+/// Multiplies the tweak by x in GF(2^128), with the little endian convention of XTS.
+void DoubleTweak(Tweak& tweak) {
+    const u64 carry = tweak[1] >> 63;
+    tweak[1] = (tweak[1] << 1) | (tweak[0] >> 63);
+    tweak[0] = (tweak[0] << 1) ^ (carry * 0x87);
+}
+
+void StoreCounter(u8* dest, u64 high, u64 low) {
+    const u64 high_be = Common::swap64(high);
+    const u64 low_be = Common::swap64(low);
+    std::memcpy(dest, &high_be, sizeof(u64));
+    std::memcpy(dest + sizeof(u64), &low_be, sizeof(u64));
+}
+
+#if defined(ARCHITECTURE_x86_64)
+
+using Block = __m128i;
+
+TARGET_AES inline Block Load(const u8* src) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+TARGET_AES inline void Store(u8* dest, Block block) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), block);
+}
+
+TARGET_AES inline Block Xor(Block a, Block b) {
+    return _mm_xor_si128(a, b);
+}
+
+TARGET_AES inline Block InverseMixColumns(Block block) {
+    return _mm_aesimc_si128(block);
+}
+
+template <std::size_t N>
+TARGET_AES inline void EncryptBlocks(Block* blocks, const Block* keys) {
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = _mm_xor_si128(blocks[i], keys[0]);
+    }
+    for (std::size_t round = 1; round < NUM_ROUND_KEYS - 1; ++round) {
+        for (std::size_t i = 0; i < N; ++i) {
+            blocks[i] = _mm_aesenc_si128(blocks[i], keys[round]);
+        }
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = _mm_aesenclast_si128(blocks[i], keys[NUM_ROUND_KEYS - 1]);
+    }
+}
+
+template <std::size_t N>
+TARGET_AES inline void DecryptBlocks(Block* blocks, const Block* keys) {
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = _mm_xor_si128(blocks[i], keys[0]);
+    }
+    for (std::size_t round = 1; round < NUM_ROUND_KEYS - 1; ++round) {
+        for (std::size_t i = 0; i < N; ++i) {
+            blocks[i] = _mm_aesdec_si128(blocks[i], keys[round]);
+        }
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = _mm_aesdeclast_si128(blocks[i], keys[NUM_ROUND_KEYS - 1]);
+    }
+}
+
+#elif defined(ARCHITECTURE_arm64)
+
+using Block = uint8x16_t;
+
+TARGET_AES inline Block Load(const u8* src) {
+    return vld1q_u8(src);
+}
+
+TARGET_AES inline void Store(u8* dest, Block block) {
+    vst1q_u8(dest, block);
+}
+
+TARGET_AES inline Block Xor(Block a, Block b) {
+    return veorq_u8(a, b);
+}
+
+TARGET_AES inline Block InverseMixColumns(Block block) {
+    return vaesimcq_u8(block);
+}
+
+// AESE and AESD add the round key before substituting, so the last round key is added apart.
+template <std::size_t N>
+TARGET_AES inline void EncryptBlocks(Block* blocks, const Block* keys) {
+    for (std::size_t round = 0; round < NUM_ROUND_KEYS - 2; ++round) {
+        for (std::size_t i = 0; i < N; ++i) {
+            blocks[i] = vaesmcq_u8(vaeseq_u8(blocks[i], keys[round]));
+        }
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = veorq_u8(vaeseq_u8(blocks[i], keys[NUM_ROUND_KEYS - 2]),
+                             keys[NUM_ROUND_KEYS - 1]);
+    }
+}
+
+template <std::size_t N>
+TARGET_AES inline void DecryptBlocks(Block* blocks, const Block* keys) {
+    for (std::size_t round = 0; round < NUM_ROUND_KEYS - 2; ++round) {
+        for (std::size_t i = 0; i < N; ++i) {
+            blocks[i] = vaesimcq_u8(vaesdq_u8(blocks[i], keys[round]));
+        }
+    }
+    for (std::size_t i = 0; i < N; ++i) {
+        blocks[i] = veorq_u8(vaesdq_u8(blocks[i], keys[NUM_ROUND_KEYS - 2]),
+                             keys[NUM_ROUND_KEYS - 1]);
+    }
+}
+
+#endif
+
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+
+using RoundKeys = std::array<std::array<u8, BLOCK_SIZE>, NUM_ROUND_KEYS>;
+
+TARGET_AES inline void LoadKeys(Block* keys, const RoundKeys& round_keys) {
+    for (std::size_t round = 0; round < NUM_ROUND_KEYS; ++round) {
+        keys[round] = Load(round_keys[round].data());
+    }
+}
+
+template <bool Encrypt, std::size_t N>
+TARGET_AES inline void CipherBlocks(Block* blocks, const Block* keys) {
+    if constexpr (Encrypt) {
+        EncryptBlocks<N>(blocks, keys);
+    } else {
+        DecryptBlocks<N>(blocks, keys);
+    }
+}
+
+TARGET_AES void MakeDecryptionKeys(KeySchedule& schedule) {
+    // The equivalent inverse cipher uses the round keys in reverse order, with InvMixColumns
+    // applied to all of them but the first and the last.
+    constexpr std::size_t last = NUM_ROUND_KEYS - 1;
+    schedule.decrypt[0] = schedule.encrypt[last];
+    for (std::size_t round = 1; round < last; ++round) {
+        Store(schedule.decrypt[round].data(),
+              InverseMixColumns(Load(schedule.encrypt[last - round].data())));
+    }
+    schedule.decrypt[last] = schedule.encrypt[0];
+}
+
+template <bool Encrypt>
+TARGET_AES void ECB(const KeySchedule& schedule, const u8* src, u8* dest,
+                    std::size_t num_blocks) {
+    Block keys[NUM_ROUND_KEYS];
+    LoadKeys(keys, Encrypt ? schedule.encrypt : schedule.decrypt);
+
+    std::size_t index = 0;
+    for (; index + LANES <= num_blocks; index += LANES) {
+        Block blocks[LANES];
+        for (std::size_t i = 0; i < LANES; ++i) {
+            blocks[i] = Load(src + (index + i) * BLOCK_SIZE);
+        }
+        CipherBlocks<Encrypt, LANES>(blocks, keys);
+        for (std::size_t i = 0; i < LANES; ++i) {
+            Store(dest + (index + i) * BLOCK_SIZE, blocks[i]);
+        }
+    }
+    for (; index < num_blocks; ++index) {
+        Block block = Load(src + index * BLOCK_SIZE);
+        CipherBlocks<Encrypt, 1>(&block, keys);
+        Store(dest + index * BLOCK_SIZE, block);
+    }
+}
+
+TARGET_AES void CTR(const KeySchedule& schedule, u8* counter, const u8* src, u8* dest,
+                    std::size_t size) {
+    Block keys[NUM_ROUND_KEYS];
+    LoadKeys(keys, schedule.encrypt);
+
+    u64 high;
+    u64 low;
+    std::memcpy(&high, counter, sizeof(u64));
+    std::memcpy(&low, counter + sizeof(u64), sizeof(u64));
+    high = Common::swap64(high);
+    low = Common::swap64(low);
+
+    std::array<u8, LANES * BLOCK_SIZE> counters;
+    while (size != 0) {
+        const std::size_t num_blocks = std::min(LANES, (size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+        for (std::size_t i = 0; i < num_blocks; ++i) {
+            StoreCounter(counters.data() + i * BLOCK_SIZE, high, low);
+            high += ++low == 0 ? 1 : 0;
+        }
+        Block blocks[LANES];
+        if (num_blocks == LANES) {
+            for (std::size_t i = 0; i < LANES; ++i) {
+                blocks[i] = Load(counters.data() + i * BLOCK_SIZE);
+            }
+            EncryptBlocks<LANES>(blocks, keys);
+        } else {
+            for (std::size_t i = 0; i < num_blocks; ++i) {
+                blocks[i] = Load(counters.data() + i * BLOCK_SIZE);
+                EncryptBlocks<1>(&blocks[i], keys);
+            }
+        }
+        const std::size_t full_blocks = std::min(num_blocks, size / BLOCK_SIZE);
+        for (std::size_t i = 0; i < full_blocks; ++i) {
+            Store(dest, Xor(Load(src), blocks[i]));
+            src += BLOCK_SIZE;
+            dest += BLOCK_SIZE;
+            size -= BLOCK_SIZE;
+        }
+        if (full_blocks != num_blocks) {
+            // Trailing partial block, only a prefix of the keystream is used
+            std::array<u8, BLOCK_SIZE> keystream;
+            Store(keystream.data(), blocks[full_blocks]);
+            for (std::size_t i = 0; i < size; ++i) {
+                dest[i] = src[i] ^ keystream[i];
+            }
+            size = 0;
+        }
+    }
+
+    StoreCounter(counter, high, low);
+}
+
+template <bool Encrypt>
+TARGET_AES void XTS(const KeySchedule& data_schedule, const KeySchedule& tweak_schedule,
+                    const u8* data_unit, const u8* src, u8* dest, std::size_t num_blocks) {
+    Block tweak_keys[NUM_ROUND_KEYS];
+    LoadKeys(tweak_keys, tweak_schedule.encrypt);
+    Block initial_tweak = Load(data_unit);
+    EncryptBlocks<1>(&initial_tweak, tweak_keys);
+
+    Tweak tweak;
+    Store(reinterpret_cast<u8*>(tweak.data()), initial_tweak);
+
+    Block keys[NUM_ROUND_KEYS];
+    LoadKeys(keys, Encrypt ? data_schedule.encrypt : data_schedule.decrypt);
+
+    std::array<Tweak, LANES> tweaks;
+    while (num_blocks != 0) {
+        const std::size_t count = std::min(LANES, num_blocks);
+        for (std::size_t i = 0; i < count; ++i) {
+            tweaks[i] = tweak;
+            DoubleTweak(tweak);
+        }
+        Block blocks[LANES];
+        Block masks[LANES];
+        for (std::size_t i = 0; i < count; ++i) {
+            masks[i] = Load(reinterpret_cast<const u8*>(tweaks[i].data()));
+            blocks[i] = Xor(Load(src + i * BLOCK_SIZE), masks[i]);
+        }
+        if (count == LANES) {
+            CipherBlocks<Encrypt, LANES>(blocks, keys);
+        } else {
+            for (std::size_t i = 0; i < count; ++i) {
+                CipherBlocks<Encrypt, 1>(&blocks[i], keys);
+            }
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            Store(dest + i * BLOCK_SIZE, Xor(blocks[i], masks[i]));
+        }
+        src += count * BLOCK_SIZE;
+        dest += count * BLOCK_SIZE;
+        num_blocks -= count;
+    }
+}
+
+#endif
+
+bool DetectSupport() {
+#if defined(ARCHITECTURE_x86_64)
+    return Common::GetCPUCaps().aes;
+#elif defined(ARCHITECTURE_arm64) && defined(__APPLE__)
+    return true;
+#elif defined(ARCHITECTURE_arm64) && defined(_WIN32)
+    return IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE) != 0;
+#elif defined(ARCHITECTURE_arm64) && defined(__linux__)
+    return (getauxval(AT_HWCAP) & HWCAP_AES) != 0;
+#else
+    return false;
+#endif
+}
+
+} // Anonymous namespace
+
+bool IsSupported() {
+    static const bool supported = DetectSupport();
+    return supported;
+}
+
+void ExpandKey(KeySchedule& schedule, const u8* key) {
+    auto& round_keys = schedule.encrypt;
+    std::memcpy(round_keys[0].data(), key, BLOCK_SIZE);
+    for (std::size_t round = 1; round < NUM_ROUND_KEYS; ++round) {
+        const auto& previous = round_keys[round - 1];
+        auto& current = round_keys[round];
+        // RotWord and SubWord of the last word of the previous round key
+        std::array<u8, 4> word{SBOX[previous[13]], SBOX[previous[14]], SBOX[previous[15]],
+                               SBOX[previous[12]]};
+        word[0] ^= RCON[round - 1];
+        for (std::size_t i = 0; i < BLOCK_SIZE; ++i) {
+            word[i % 4] ^= previous[i];
+            current[i] = word[i % 4];
+        }
+    }
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    MakeDecryptionKeys(schedule);
+#else
+    UNREACHABLE();
+#endif
+}
+
+void TranscodeECB(const KeySchedule& schedule, const u8* src, u8* dest, std::size_t num_blocks,
+                  bool encrypt) {
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    if (encrypt) {
+        ECB<true>(schedule, src, dest, num_blocks);
+    } else {
+        ECB<false>(schedule, src, dest, num_blocks);
+    }
+#else
+    UNREACHABLE();
+#endif
+}
+
+void TranscodeCTR(const KeySchedule& schedule, u8* counter, const u8* src, u8* dest,
+                  std::size_t size) {
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    CTR(schedule, counter, src, dest, size);
+#else
+    UNREACHABLE();
+#endif
+}
+
+void TranscodeXTS(const KeySchedule& data_schedule, const KeySchedule& tweak_schedule,
+                  const u8* data_unit, const u8* src, u8* dest, std::size_t num_blocks,
+                  bool encrypt) {
+#if defined(ARCHITECTURE_x86_64) || defined(ARCHITECTURE_arm64)
+    if (encrypt) {
+        XTS<true>(data_schedule, tweak_schedule, data_unit, src, dest, num_blocks);
+    } else {
+        XTS<false>(data_schedule, tweak_schedule, data_unit, src, dest, num_blocks);
+    }
+#else
+    UNREACHABLE();
+#endif
+}
+
+} // namespace Core::Crypto::AESHW
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include "common/common_types.h"
+
+/**
+ * AES-128 implemented with the AES instructions of the host, AES-NI on x86-64 and the ARMv8
+ * cryptography extension on arm64.
+ *
+ * Key schedules are expanded once and reused by every call, and the modes process eight
+ * independent blocks at a time so that the latency of the AES instructions is hidden. The
+ * functions must only be called when IsSupported returns true, AESCipher falls back to mbedtls
+ * otherwise.
+ */
+namespace Core::Crypto::AESHW {
+
+/// Size of an AES block in bytes
+constexpr std::size_t BLOCK_SIZE = 0x10;
+
+/// Number of round keys of AES-128
+constexpr std::size_t NUM_ROUND_KEYS = 11;
+
+/// Round keys of the cipher and of the equivalent inverse cipher
+struct KeySchedule {
+    alignas(16) std::array<std::array<u8, BLOCK_SIZE>, NUM_ROUND_KEYS> encrypt;
+    alignas(16) std::array<std::array<u8, BLOCK_SIZE>, NUM_ROUND_KEYS> decrypt;
+};
+
+/// Returns true when the host supports the AES instructions, detected once at runtime.
+[[nodiscard]] bool IsSupported();
+
+/**
+ * Expands a 128-bit key into its encryption and decryption round keys.
+ *
+ * @param schedule - Output key schedule.
+ * @param key      - 16 bytes of key.
+ */
+void ExpandKey(KeySchedule& schedule, const u8* key);
+
+/**
+ * Encrypts or decrypts whole blocks in ECB mode.
+ *
+ * @param schedule   - Key schedule.
+ * @param src        - Source blocks, may alias dest.
+ * @param dest       - Destination blocks.
+ * @param num_blocks - Number of blocks.
+ * @param encrypt    - Encrypts when true, decrypts otherwise.
+ */
+void TranscodeECB(const KeySchedule& schedule, const u8* src, u8* dest, std::size_t num_blocks,
+                  bool encrypt);
+
+/**
+ * Transcodes data in CTR mode, which is the same operation in both directions.
+ *
+ * The keystream starts at the beginning of the counter block, and the counter is advanced by
+ * every block used, including a trailing partial block.
+ *
+ * @param schedule - Key schedule.
+ * @param counter  - 16 byte big endian counter, updated on return.
+ * @param src      - Source data, may alias dest.
+ * @param dest     - Destination data.
+ * @param size     - Size of the data in bytes.
+ */
+void TranscodeCTR(const KeySchedule& schedule, u8* counter, const u8* src, u8* dest,
+                  std::size_t size);
+
+/**
+ * Encrypts or decrypts a data unit of whole blocks in XTS mode.
+ *
+ * @param data_schedule  - Key schedule of the first half of the XTS key.
+ * @param tweak_schedule - Key schedule of the second half of the XTS key.
+ * @param data_unit      - 16 byte data unit number, encrypted into the initial tweak.
+ * @param src            - Source blocks, may alias dest.
+ * @param dest           - Destination blocks.
+ * @param num_blocks     - Number of blocks.
+ * @param encrypt        - Encrypts when true, decrypts otherwise.
+ */
+void TranscodeXTS(const KeySchedule& data_schedule, const KeySchedule& tweak_schedule,
+                  const u8* data_unit, const u8* src, u8* dest, std::size_t num_blocks,
+                  bool encrypt);
+
+} // namespace Core::Crypto::AESHW
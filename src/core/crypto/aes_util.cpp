@@ -1,10 +1,13 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <array>
+#include <cstring>
 #include <mbedtls/cipher.h>
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "core/crypto/aes_hw.h"
 #include "core/crypto/aes_util.h"
 #include "core/crypto/key_manager.h"
 
@@ -36,8 +39,52 @@ static_assert(static_cast<std::size_t>(Mode::XTS) ==
 struct CipherContext {
     mbedtls_cipher_context_t encryption_context;
     mbedtls_cipher_context_t decryption_context;
+
+    // Hardware backend state, mbedtls is only used when this is not available
+    bool use_hw;
+    Mode mode;
+    AESHW::KeySchedule data_key;
+    AESHW::KeySchedule tweak_key;
+    std::array<u8, AESHW::BLOCK_SIZE> encryption_iv;
+    std::array<u8, AESHW::BLOCK_SIZE> decryption_iv;
 };
 
+namespace {
+/// Transcodes with the hardware backend, returns false when mbedtls has to handle the request.
+bool TranscodeHW(CipherContext& ctx, const u8* src, std::size_t size, u8* dest, Op op) {
+    constexpr std::size_t block_size = AESHW::BLOCK_SIZE;
+    const bool encrypt = op == Op::Encrypt;
+    switch (ctx.mode) {
+    case Mode::CTR: {
+        auto& counter = encrypt ? ctx.encryption_iv : ctx.decryption_iv;
+        AESHW::TranscodeCTR(ctx.data_key, counter.data(), src, dest, size);
+        return true;
+    }
+    case Mode::ECB: {
+        const std::size_t num_blocks = size / block_size;
+        AESHW::TranscodeECB(ctx.data_key, src, dest, num_blocks, encrypt);
+        if (const std::size_t tail = size % block_size; tail != 0) {
+            // A trailing partial block is zero padded, like the mbedtls path does
+            std::array<u8, block_size> block{};
+            std::memcpy(block.data(), src + num_blocks * block_size, tail);
+            AESHW::TranscodeECB(ctx.data_key, block.data(), block.data(), 1, encrypt);
+            std::memcpy(dest + num_blocks * block_size, block.data(), tail);
+        }
+        return true;
+    }
+    case Mode::XTS:
+        // Ciphertext stealing is left to mbedtls
+        if (size < block_size || size % block_size != 0) {
+            return false;
+        }
+        AESHW::TranscodeXTS(ctx.data_key, ctx.tweak_key, ctx.encryption_iv.data(), src, dest,
+                            size / block_size, encrypt);
+        return true;
+    }
+    return false;
+}
+} // Anonymous namespace
+
 template <typename Key, std::size_t KeySize>
 Crypto::AESCipher<Key, KeySize>::AESCipher(Key key, Mode mode)
     : ctx(std::make_unique<CipherContext>()) {
@@ -57,6 +104,18 @@ Crypto::AESCipher<Key, KeySize>::AESCipher(Key key, Mode mode)
     ASSERT(
         !mbedtls_cipher_setkey(&ctx->decryption_context, key.data(), KeySize * 8, MBEDTLS_DECRYPT));
     //"Failed to set key on mbedtls ciphers.");
+
+    ctx->mode = mode;
+    ctx->encryption_iv = {};
+    ctx->decryption_iv = {};
+    ctx->use_hw = AESHW::IsSupported() && (mode == Mode::XTS ? KeySize == 0x20 : KeySize == 0x10);
+    if (ctx->use_hw) {
+        // The key schedules are expanded once here instead of on every call
+        AESHW::ExpandKey(ctx->data_key, key.data());
+        if (mode == Mode::XTS) {
+            AESHW::ExpandKey(ctx->tweak_key, key.data() + AESHW::BLOCK_SIZE);
+        }
+    }
 }
 
 template <typename Key, std::size_t KeySize>
@@ -67,6 +126,10 @@ AESCipher<Key, KeySize>::~AESCipher() {
 
 template <typename Key, std::size_t KeySize>
 void AESCipher<Key, KeySize>::Transcode(const u8* src, std::size_t size, u8* dest, Op op) const {
+    if (ctx->use_hw && TranscodeHW(*ctx, src, size, dest, op)) {
+        return;
+    }
+
     auto* const context = op == Op::Encrypt ? &ctx->encryption_context : &ctx->decryption_context;
 
     mbedtls_cipher_reset(context);
@@ -122,6 +185,11 @@ void AESCipher<Key, KeySize>::SetIV(std::span<const u8> data) {
     ASSERT_MSG((mbedtls_cipher_set_iv(&ctx->encryption_context, data.data(), data.size()) ||
                 mbedtls_cipher_set_iv(&ctx->decryption_context, data.data(), data.size())) == 0,
                "Failed to set IV on mbedtls ciphers.");
+
+    ctx->encryption_iv = {};
+    std::memcpy(ctx->encryption_iv.data(), data.data(),
+                std::min(data.size(), ctx->encryption_iv.size()));
+    ctx->decryption_iv = ctx->encryption_iv;
 }
 
 template class AESCipher<Key128>;
@@ -6,6 +6,7 @@
 #include <array>
 #include <filesystem>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <span>
 #include <string>
@@ -15,6 +16,7 @@
 #include "common/common_funcs.h"
 #include "common/common_types.h"
 #include "core/crypto/partition_data_manager.h"
+#include "core/crypto/sha_util.h"
 
 namespace Common::FS {
 class IOFile;
@@ -32,7 +34,6 @@ namespace Core::Crypto {
 
 using Key128 = std::array<u8, 0x10>;
 using Key256 = std::array<u8, 0x20>;
-using SHA256Hash = std::array<u8, 0x20>;
 
 enum class SignatureType {
     RSA_4096_SHA1 = 0x10000,
@@ -287,8 +288,9 @@ public:
 
     void PopulateFromPartitionData(PartitionDataManager& data);
 
-    const std::map<u128, Ticket>& GetCommonTickets() const;
-    const std::map<u128, Ticket>& GetPersonalizedTickets() const;
+    // Return copies, as tickets can be added from other threads while the maps are in use.
+    std::map<u128, Ticket> GetCommonTickets() const;
+    std::map<u128, Ticket> GetPersonalizedTickets() const;
 
     bool AddTicket(const Ticket& ticket);
 
@@ -301,6 +303,9 @@ public:
 private:
     KeyManager();
 
+    // Guards the keys and the tickets, as NCAs and NSPs can be parsed from
+    // several threads. SetKey reloads the key files it writes to, hence recursive.
+    mutable std::recursive_mutex key_mutex;
     std::map<KeyIndex<S128KeyType>, Key128> s128_keys;
     std::map<KeyIndex<S256KeyType>, Key256> s256_keys;
 
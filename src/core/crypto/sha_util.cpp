@@ -1,4 +1,279 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
-namespace Crypto {} // namespace Crypto
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/auxv.h>
+#endif
+#endif
+
+#include "common/swap.h"
+#include "core/crypto/sha_util.h"
+
+#if defined(ARCHITECTURE_x86_64) && !defined(_MSC_VER)
+#define TARGET_SHA __attribute__((target("sha,sse4.1")))
+#elif defined(ARCHITECTURE_arm64) && defined(__clang__)
+#define TARGET_SHA __attribute__((target("sha2")))
+#elif defined(ARCHITECTURE_arm64) && defined(__GNUC__)
+#define TARGET_SHA __attribute__((target("+sha2")))
+#else
+#define TARGET_SHA
+#endif
+
+#if defined(ARCHITECTURE_arm64) && defined(__linux__) && !defined(HWCAP_SHA2)
+#define HWCAP_SHA2 (1 << 6)
+#endif
+
+namespace Core::Crypto {
+
+namespace {
+
+using Compressor = void (*)(u32* state, const u8* data, std::size_t num_blocks);
+
+constexpr std::array<u32, 8> InitialState{
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+alignas(16) constexpr std::array<u32, 64> RoundConstants{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+void CompressPortable(u32* state, const u8* data, std::size_t num_blocks) {
+    for (; num_blocks != 0; --num_blocks, data += SHA256Hasher::BlockSize) {
+        std::array<u32, 64> w;
+        for (std::size_t i = 0; i < 16; ++i) {
+            u32 word;
+            std::memcpy(&word, data + i * sizeof(u32), sizeof(u32));
+            w[i] = Common::swap32(word);
+        }
+        for (std::size_t i = 16; i < 64; ++i) {
+            const u32 s0 = std::rotr(w[i - 15], 7) ^ std::rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+            const u32 s1 = std::rotr(w[i - 2], 17) ^ std::rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+            w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+        }
+
+        u32 a = state[0], b = state[1], c = state[2], d = state[3];
+        u32 e = state[4], f = state[5], g = state[6], h = state[7];
+        for (std::size_t i = 0; i < 64; ++i) {
+            const u32 s1 = std::rotr(e, 6) ^ std::rotr(e, 11) ^ std::rotr(e, 25);
+            const u32 choice = (e & f) ^ (~e & g);
+            const u32 temp1 = h + s1 + choice + RoundConstants[i] + w[i];
+            const u32 s0 = std::rotr(a, 2) ^ std::rotr(a, 13) ^ std::rotr(a, 22);
+            const u32 majority = (a & b) ^ (a & c) ^ (b & c);
+            const u32 temp2 = s0 + majority;
+            h = g;
+            g = f;
+            f = e;
+            e = d + temp1;
+            d = c;
+            c = b;
+            b = a;
+            a = temp1 + temp2;
+        }
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+    }
+}
+
+#if defined(ARCHITECTURE_x86_64)
+
+TARGET_SHA void CompressSHANI(u32* state, const u8* data, std::size_t num_blocks) {
+    const __m128i byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // The SHA-NI instructions keep the state as ABEF and CDGH
+    const __m128i cdab =
+        _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i*>(state)), 0xB1);
+    const __m128i efgh =
+        _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<__m128i*>(state + 4)), 0x1B);
+    __m128i abef = _mm_alignr_epi8(cdab, efgh, 8);
+    __m128i cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+
+    for (; num_blocks != 0; --num_blocks, data += SHA256Hasher::BlockSize) {
+        const __m128i abef_save = abef;
+        const __m128i cdgh_save = cdgh;
+
+        // Each group of four rounds extends the message schedule by four words
+        __m128i w[4];
+        for (std::size_t group = 0; group < 16; ++group) {
+            __m128i& cur = w[group % 4];
+            if (group < 4) {
+                const auto* src = reinterpret_cast<const __m128i*>(data + group * 16);
+                cur = _mm_shuffle_epi8(_mm_loadu_si128(src), byte_swap);
+            } else {
+                const __m128i prev1 = w[(group + 3) % 4];
+                const __m128i prev2 = w[(group + 2) % 4];
+                const __m128i sum = _mm_add_epi32(_mm_sha256msg1_epu32(cur, w[(group + 1) % 4]),
+                                                  _mm_alignr_epi8(prev1, prev2, 4));
+                cur = _mm_sha256msg2_epu32(sum, prev1);
+            }
+            const auto* k = reinterpret_cast<const __m128i*>(RoundConstants.data() + group * 4);
+            const __m128i msg = _mm_add_epi32(cur, _mm_load_si128(k));
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, msg);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(msg, 0x0E));
+        }
+
+        abef = _mm_add_epi32(abef, abef_save);
+        cdgh = _mm_add_epi32(cdgh, cdgh_save);
+    }
+
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state), _mm_blend_epi16(feba, dchg, 0xF0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), _mm_alignr_epi8(dchg, feba, 8));
+}
+
+#elif defined(ARCHITECTURE_arm64)
+
+TARGET_SHA void CompressARMv8(u32* state, const u8* data, std::size_t num_blocks) {
+    uint32x4_t abcd = vld1q_u32(state);
+    uint32x4_t efgh = vld1q_u32(state + 4);
+
+    for (; num_blocks != 0; --num_blocks, data += SHA256Hasher::BlockSize) {
+        const uint32x4_t abcd_save = abcd;
+        const uint32x4_t efgh_save = efgh;
+
+        // Each group of four rounds extends the message schedule by four words
+        uint32x4_t w[4];
+        for (std::size_t group = 0; group < 16; ++group) {
+            uint32x4_t& cur = w[group % 4];
+            if (group < 4) {
+                cur = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + group * 16)));
+            } else {
+                cur = vsha256su1q_u32(vsha256su0q_u32(cur, w[(group + 1) % 4]),
+                                      w[(group + 2) % 4], w[(group + 3) % 4]);
+            }
+            const uint32x4_t msg = vaddq_u32(cur, vld1q_u32(RoundConstants.data() + group * 4));
+            const uint32x4_t prev_abcd = abcd;
+            abcd = vsha256hq_u32(abcd, efgh, msg);
+            efgh = vsha256h2q_u32(efgh, prev_abcd, msg);
+        }
+
+        abcd = vaddq_u32(abcd, abcd_save);
+        efgh = vaddq_u32(efgh, efgh_save);
+    }
+
+    vst1q_u32(state, abcd);
+    vst1q_u32(state + 4, efgh);
+}
+
+#endif
+
+Compressor SelectCompressor() {
+#if defined(ARCHITECTURE_x86_64)
+    const auto& caps = Common::GetCPUCaps();
+    if (caps.sha && caps.sse4_1) {
+        return CompressSHANI;
+    }
+#elif defined(ARCHITECTURE_arm64) && defined(__APPLE__)
+    return CompressARMv8;
+#elif defined(ARCHITECTURE_arm64) && defined(_WIN32)
+    if (IsProcessorFeaturePresent(PF_ARM_V8_CRYPTO_INSTRUCTIONS_AVAILABLE)) {
+        return CompressARMv8;
+    }
+#elif defined(ARCHITECTURE_arm64) && defined(__linux__)
+    if ((getauxval(AT_HWCAP) & HWCAP_SHA2) != 0) {
+        return CompressARMv8;
+    }
+#endif
+    return CompressPortable;
+}
+
+Compressor GetCompressor() {
+    static const Compressor compressor = SelectCompressor();
+    return compressor;
+}
+
+} // Anonymous namespace
+
+SHA256Hasher::SHA256Hasher() {
+    Reset();
+}
+
+void SHA256Hasher::Update(std::span<const u8> data) {
+    total_size += data.size();
+
+    // Complete a partially filled block first
+    if (buffer_size != 0) {
+        const std::size_t copy_size = std::min(BlockSize - buffer_size, data.size());
+        std::memcpy(buffer.data() + buffer_size, data.data(), copy_size);
+        buffer_size += copy_size;
+        data = data.subspan(copy_size);
+        if (buffer_size != BlockSize) {
+            return;
+        }
+        GetCompressor()(state.data(), buffer.data(), 1);
+        buffer_size = 0;
+    }
+
+    const std::size_t num_blocks = data.size() / BlockSize;
+    if (num_blocks != 0) {
+        GetCompressor()(state.data(), data.data(), num_blocks);
+        data = data.subspan(num_blocks * BlockSize);
+    }
+
+    std::memcpy(buffer.data(), data.data(), data.size());
+    buffer_size = data.size();
+}
+
+SHA256Hash SHA256Hasher::Finalize() {
+    // Pad with a one bit, zeros and the big endian size in bits
+    const u64 size_bits = Common::swap64(total_size * 8);
+    buffer[buffer_size++] = 0x80;
+    if (buffer_size > BlockSize - sizeof(u64)) {
+        std::memset(buffer.data() + buffer_size, 0, BlockSize - buffer_size);
+        GetCompressor()(state.data(), buffer.data(), 1);
+        buffer_size = 0;
+    }
+    std::memset(buffer.data() + buffer_size, 0, BlockSize - sizeof(u64) - buffer_size);
+    std::memcpy(buffer.data() + BlockSize - sizeof(u64), &size_bits, sizeof(u64));
+    GetCompressor()(state.data(), buffer.data(), 1);
+
+    SHA256Hash hash;
+    for (std::size_t i = 0; i < state.size(); ++i) {
+        const u32 word = Common::swap32(state[i]);
+        std::memcpy(hash.data() + i * sizeof(u32), &word, sizeof(u32));
+    }
+    Reset();
+    return hash;
+}
+
+SHA256Hash SHA256Hasher::Hash(std::span<const u8> data) {
+    SHA256Hasher hasher;
+    hasher.Update(data);
+    return hasher.Finalize();
+}
+
+bool SHA256Hasher::IsAccelerated() {
+    return GetCompressor() != CompressPortable;
+}
+
+void SHA256Hasher::Reset() {
+    state = InitialState;
+    buffer_size = 0;
+    total_size = 0;
+}
+
+} // namespace Core::Crypto
@@ -3,17 +3,46 @@
 
 #pragma once
 
-#include "common/assert.h"
-#include "core/file_sys/vfs.h"
-#include "key_manager.h"
-#include "mbedtls/cipher.h"
+#include <array>
+#include <span>
 
-namespace Crypto {
-typedef std::array<u8, 0x20> SHA256Hash;
+#include "common/common_types.h"
 
-inline SHA256Hash operator"" _HASH(const char* data, size_t len) {
-    if (len != 0x40)
-        return {};
-}
+namespace Core::Crypto {
 
-} // namespace Crypto
+using SHA256Hash = std::array<u8, 0x20>;
+
+/**
+ * Incremental SHA-256.
+ *
+ * Blocks are compressed with the SHA extensions of the host when it has them, SHA-NI on x86-64
+ * and the ARMv8 SHA2 instructions on arm64, and with a portable implementation otherwise. The
+ * implementation is selected once at runtime.
+ */
+class SHA256Hasher {
+public:
+    static constexpr std::size_t BlockSize = 0x40;
+
+    SHA256Hasher();
+
+    void Update(std::span<const u8> data);
+
+    /// Returns the hash of the data passed to Update, and resets the hasher.
+    [[nodiscard]] SHA256Hash Finalize();
+
+    /// Returns the hash of data.
+    [[nodiscard]] static SHA256Hash Hash(std::span<const u8> data);
+
+    /// Returns true when the SHA extensions of the host are used.
+    [[nodiscard]] static bool IsAccelerated();
+
+private:
+    void Reset();
+
+    std::array<u32, 8> state;
+    std::array<u8, BlockSize> buffer;
+    std::size_t buffer_size;
+    u64 total_size;
+};
+
+} // namespace Core::Crypto
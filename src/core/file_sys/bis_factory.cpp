@@ -55,12 +55,14 @@ VirtualDir BISFactory::GetModificationLoadRoot(u64 title_id) const {
     // LayeredFS doesn't work on updates and title id-less homebrew
     if (title_id == 0 || (title_id & 0xFFF) == 0x800)
         return nullptr;
+    std::scoped_lock lk{mod_root_mutex};
     return GetOrCreateDirectoryRelative(load_root, fmt::format("/{:016X}", title_id));
 }
 
 VirtualDir BISFactory::GetModificationDumpRoot(u64 title_id) const {
     if (title_id == 0)
         return nullptr;
+    std::scoped_lock lk{mod_root_mutex};
     return GetOrCreateDirectoryRelative(dump_root, fmt::format("/{:016X}", title_id));
 }
 
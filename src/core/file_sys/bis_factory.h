@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "common/common_types.h"
 #include "core/file_sys/vfs/vfs_types.h"
@@ -68,6 +69,10 @@ private:
     VirtualDir load_root;
     VirtualDir dump_root;
 
+    /// Serializes the creation of the per-title modification directories, which may be looked up
+    /// from several threads, such as the game list scan.
+    mutable std::mutex mod_root_mutex;
+
     std::unique_ptr<RegisteredCache> sysnand_cache;
     std::unique_ptr<RegisteredCache> usrnand_cache;
 
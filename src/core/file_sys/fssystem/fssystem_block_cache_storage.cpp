@@ -0,0 +1,213 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/assert.h"
+#include "common/div_ceil.h"
+#include "core/file_sys/fssystem/fssystem_block_cache_storage.h"
+
+namespace FileSys {
+
+void BlockCache::SetCapacity(size_t capacity) {
+    std::scoped_lock lk{m_mutex};
+    m_capacity = capacity;
+    this->Evict(m_capacity);
+}
+
+size_t BlockCache::GetCapacity() const {
+    std::scoped_lock lk{m_mutex};
+    return m_capacity;
+}
+
+size_t BlockCache::GetUsedSize() const {
+    std::scoped_lock lk{m_mutex};
+    return m_used_size;
+}
+
+BlockCache::Counters BlockCache::GetCounters() const {
+    std::scoped_lock lk{m_mutex};
+    return m_counters;
+}
+
+u64 BlockCache::AllocateStorageId() {
+    std::scoped_lock lk{m_mutex};
+    return m_next_storage_id++;
+}
+
+bool BlockCache::Read(u64 storage_id, u64 block, u8* buffer, size_t offset, size_t size) {
+    std::scoped_lock lk{m_mutex};
+    const auto it = m_entry_map.find(Key{storage_id, block});
+    if (it == m_entry_map.end()) {
+        return false;
+    }
+    Entry& entry = *it->second;
+    ASSERT(offset + size <= entry.data.size());
+    std::memcpy(buffer, entry.data.data() + offset, size);
+
+    ++m_counters.hits;
+    if (entry.read_ahead) {
+        ++m_counters.read_ahead_hits;
+        entry.read_ahead = false;
+    }
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return true;
+}
+
+bool BlockCache::Contains(u64 storage_id, u64 block) const {
+    std::scoped_lock lk{m_mutex};
+    return m_entry_map.contains(Key{storage_id, block});
+}
+
+void BlockCache::Insert(u64 storage_id, u64 block, const u8* data, size_t size, bool read_ahead) {
+    std::scoped_lock lk{m_mutex};
+    const Key key{storage_id, block};
+    if (m_entry_map.contains(key)) {
+        return;
+    }
+    if (read_ahead) {
+        ++m_counters.read_ahead_blocks;
+    } else {
+        ++m_counters.misses;
+    }
+    if (size > m_capacity) {
+        return;
+    }
+    this->Evict(m_capacity - size);
+
+    m_entries.push_front(Entry{key, std::vector<u8>(data, data + size), read_ahead});
+    m_entry_map.emplace(key, m_entries.begin());
+    m_used_size += size;
+}
+
+void BlockCache::Invalidate(u64 storage_id) {
+    std::scoped_lock lk{m_mutex};
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (it->key.storage_id != storage_id) {
+            ++it;
+            continue;
+        }
+        m_used_size -= it->data.size();
+        m_entry_map.erase(it->key);
+        it = m_entries.erase(it);
+    }
+}
+
+void BlockCache::Evict(size_t capacity) {
+    while (m_used_size > capacity) {
+        const Entry& entry = m_entries.back();
+        m_used_size -= entry.data.size();
+        m_entry_map.erase(entry.key);
+        m_entries.pop_back();
+        ++m_counters.evictions;
+    }
+}
+
+BlockCacheStorage::BlockCacheStorage(VirtualFile base, std::shared_ptr<BlockCache> cache)
+    : m_base_storage(std::move(base)), m_cache(std::move(cache)) {
+    ASSERT(m_base_storage != nullptr);
+    ASSERT(m_cache != nullptr);
+
+    m_storage_id = m_cache->AllocateStorageId();
+    m_size = m_base_storage->GetSize();
+}
+
+BlockCacheStorage::~BlockCacheStorage() {
+    m_cache->Invalidate(m_storage_id);
+}
+
+size_t BlockCacheStorage::Read(u8* buffer, size_t size, size_t offset) const {
+    // Allow zero-size reads, and truncate reads past the end.
+    if (size == 0 || offset >= m_size) {
+        return 0;
+    }
+    size = std::min(size, m_size - offset);
+
+    // Ensure buffer is valid.
+    ASSERT(buffer != nullptr);
+
+    // Large reads would only evict the blocks that are read again.
+    if (size >= BypassSize) {
+        return m_base_storage->Read(buffer, size, offset);
+    }
+
+    std::scoped_lock lk{m_mutex};
+
+    // A read is sequential when it starts in or right after the last block of the previous read.
+    const u64 first_block = offset / BlockSize;
+    const u64 last_block = (offset + size - 1) / BlockSize;
+    const bool sequential = first_block == m_next_block || first_block + 1 == m_next_block;
+    m_next_block = last_block + 1;
+
+    size_t read_size = 0;
+    u64 block = first_block;
+    while (block <= last_block) {
+        const size_t cur_offset = offset + read_size;
+        const size_t block_offset = cur_offset - static_cast<size_t>(block) * BlockSize;
+        const size_t copy_size = std::min(BlockSize - block_offset, size - read_size);
+        if (m_cache->Read(m_storage_id, block, buffer + read_size, block_offset, copy_size)) {
+            read_size += copy_size;
+            ++block;
+            continue;
+        }
+
+        // Gather the run of missing blocks, so that the base storage is read once for all.
+        u64 end = block + 1;
+        while (end <= last_block && !m_cache->Contains(m_storage_id, end)) {
+            ++end;
+        }
+
+        // Read ahead when the run reaches the end of a sequential read.
+        u64 read_ahead = 0;
+        if (end > last_block) {
+            m_read_ahead = sequential ? std::clamp(m_read_ahead * 2, MinReadAheadBlocks,
+                                                   MaxReadAheadBlocks)
+                                      : 0;
+            read_ahead = m_read_ahead;
+        }
+
+        const size_t missing_size =
+            std::min(static_cast<size_t>(end) * BlockSize, offset + size) - cur_offset;
+        const size_t result = this->ReadMissingBlocks(buffer + read_size, missing_size,
+                                                      cur_offset, block, end, read_ahead);
+        read_size += result;
+        if (result != missing_size) {
+            break;
+        }
+        block = end;
+    }
+
+    return read_size;
+}
+
+size_t BlockCacheStorage::ReadMissingBlocks(u8* buffer, size_t size, size_t offset, u64 block,
+                                            u64 end, u64 read_ahead) const {
+    // Read the blocks, and the read ahead ones that fit in the storage.
+    const u64 block_count = Common::DivCeil(m_size, BlockSize);
+    const u64 read_end = std::min(end + read_ahead, block_count);
+    const size_t base_offset = static_cast<size_t>(block) * BlockSize;
+    const size_t base_size = std::min(static_cast<size_t>(read_end) * BlockSize, m_size) -
+                             base_offset;
+    std::vector<u8> data(base_size);
+    const size_t base_read = m_base_storage->Read(data.data(), base_size, base_offset);
+
+    // Cache the blocks that were read completely.
+    for (u64 cur_block = block; cur_block < read_end; ++cur_block) {
+        const size_t start = static_cast<size_t>(cur_block - block) * BlockSize;
+        const size_t block_size = std::min(BlockSize, base_size - start);
+        if (start + block_size > base_read) {
+            break;
+        }
+        m_cache->Insert(m_storage_id, cur_block, data.data() + start, block_size,
+                        cur_block >= end);
+    }
+
+    // Copy the requested part.
+    const size_t skip_size = offset - base_offset;
+    const size_t copy_size = base_read > skip_size ? std::min(size, base_read - skip_size) : 0;
+    std::memcpy(buffer, data.data() + skip_size, copy_size);
+    return copy_size;
+}
+
+} // namespace FileSys
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/literals.h"
+#include "core/file_sys/fssystem/fs_i_storage.h"
+
+namespace FileSys {
+
+using namespace Common::Literals;
+
+/**
+ * Least recently used cache of decrypted and verified storage blocks.
+ *
+ * A single cache is shared by every BlockCacheStorage, so that the memory budget covers all the
+ * open NCAs. Blocks are keyed by the id of the storage they belong to and their index.
+ */
+class BlockCache {
+    CITRON_NON_COPYABLE(BlockCache);
+    CITRON_NON_MOVEABLE(BlockCache);
+
+public:
+    static constexpr size_t BlockSize = 16_KiB;
+
+    struct Counters {
+        u64 hits;              ///< Blocks read from the cache
+        u64 misses;            ///< Blocks read from the base storage because a read needed them
+        u64 read_ahead_blocks; ///< Blocks read from the base storage ahead of a sequential read
+        u64 read_ahead_hits;   ///< Read ahead blocks that were read before being evicted
+        u64 evictions;         ///< Blocks dropped to stay within the capacity
+    };
+
+    explicit BlockCache(size_t capacity = 0) : m_capacity(capacity) {}
+
+    /// Sets the memory budget in bytes, evicting blocks past it.
+    void SetCapacity(size_t capacity);
+
+    [[nodiscard]] size_t GetCapacity() const;
+
+    /// Returns the number of bytes of cached blocks.
+    [[nodiscard]] size_t GetUsedSize() const;
+
+    [[nodiscard]] Counters GetCounters() const;
+
+    /// Returns a new id for a storage caching its blocks here.
+    [[nodiscard]] u64 AllocateStorageId();
+
+    /// Copies part of a cached block and marks it as recently used.
+    /// @returns False when the block is not cached
+    bool Read(u64 storage_id, u64 block, u8* buffer, size_t offset, size_t size);
+
+    [[nodiscard]] bool Contains(u64 storage_id, u64 block) const;
+
+    /// Caches a block read from the base storage, evicting the least recently used blocks.
+    void Insert(u64 storage_id, u64 block, const u8* data, size_t size, bool read_ahead);
+
+    /// Drops all the blocks of a storage.
+    void Invalidate(u64 storage_id);
+
+private:
+    struct Key {
+        u64 storage_id;
+        u64 block;
+
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept {
+            return static_cast<size_t>(key.block * 0x9E3779B97F4A7C15ULL ^ key.storage_id);
+        }
+    };
+
+    struct Entry {
+        Key key;
+        std::vector<u8> data;
+        bool read_ahead;
+    };
+
+    void Evict(size_t capacity);
+
+    mutable std::mutex m_mutex;
+    size_t m_capacity;
+    size_t m_used_size{};
+    u64 m_next_storage_id{};
+    Counters m_counters{};
+    std::list<Entry> m_entries; ///< Most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_entry_map;
+};
+
+/**
+ * Read only storage caching the blocks of its base storage in a BlockCache.
+ *
+ * Blocks missing from the cache are read from the base storage in a single read. When reads are
+ * sequential the next blocks are read ahead in the same base read, with a window that doubles on
+ * every sequential miss. Reads larger than BypassSize go straight to the base storage.
+ */
+class BlockCacheStorage : public IReadOnlyStorage {
+    CITRON_NON_COPYABLE(BlockCacheStorage);
+    CITRON_NON_MOVEABLE(BlockCacheStorage);
+
+public:
+    static constexpr size_t BlockSize = BlockCache::BlockSize;
+    static constexpr size_t BypassSize = 256_KiB;
+    static constexpr u64 MinReadAheadBlocks = 2;
+    static constexpr u64 MaxReadAheadBlocks = 16;
+
+    BlockCacheStorage(VirtualFile base, std::shared_ptr<BlockCache> cache);
+    ~BlockCacheStorage() override;
+
+    virtual size_t GetSize() const override {
+        return m_size;
+    }
+
+    virtual size_t Read(u8* buffer, size_t size, size_t offset) const override;
+
+private:
+    /// Reads blocks [block, end) from the base storage, read ahead included, and caches them.
+    size_t ReadMissingBlocks(u8* buffer, size_t size, size_t offset, u64 block, u64 end,
+                             u64 read_ahead) const;
+
+    VirtualFile m_base_storage;
+    std::shared_ptr<BlockCache> m_cache;
+    u64 m_storage_id;
+    size_t m_size;
+
+    mutable std::mutex m_mutex;
+    mutable u64 m_next_block{};
+    mutable u64 m_read_ahead{};
+};
+
+} // namespace FileSys
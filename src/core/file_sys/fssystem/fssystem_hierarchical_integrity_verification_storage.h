@@ -113,9 +113,10 @@ public:
         this->Finalize();
     }
 
+    /// @param verify Whether every layer checks its blocks against the hashes of the layer above
     Result Initialize(const HierarchicalIntegrityVerificationInformation& info,
                       HierarchicalStorageInformation storage, int max_data_cache_entries,
-                      int max_hash_cache_entries, s8 buffer_level);
+                      int max_hash_cache_entries, s8 buffer_level, bool verify = false);
     void Finalize();
 
     virtual size_t Read(u8* buffer, size_t size, size_t offset) const override;
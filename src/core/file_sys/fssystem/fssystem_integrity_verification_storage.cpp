@@ -1,18 +1,43 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <atomic>
+#include <latch>
+#include <thread>
+
 #include "common/alignment.h"
+#include "common/div_ceil.h"
+#include "common/logging/log.h"
+#include "common/thread_worker.h"
+#include "core/crypto/sha_util.h"
 #include "core/file_sys/fssystem/fssystem_integrity_verification_storage.h"
 
 namespace FileSys {
 
+namespace {
+
+// Reads of more blocks than this are hashed in parallel, in chunks of this many blocks.
+constexpr s64 ParallelVerificationChunkBlocks = 4;
+
+size_t GetVerificationWorkerCount() {
+    return std::max(std::thread::hardware_concurrency(), 2U) - 1;
+}
+
+Common::ThreadWorker& GetVerificationWorkers() {
+    static Common::ThreadWorker workers(GetVerificationWorkerCount(), "IntegrityVerification");
+    return workers;
+}
+
+} // Anonymous namespace
+
 constexpr inline u32 ILog2(u32 val) {
     ASSERT(val > 0);
     return static_cast<u32>((sizeof(u32) * 8) - 1 - std::countl_zero<u32>(val));
 }
 
 void IntegrityVerificationStorage::Initialize(VirtualFile hs, VirtualFile ds, s64 verif_block_size,
-                                              s64 upper_layer_verif_block_size, bool is_real_data) {
+                                              s64 upper_layer_verif_block_size, bool is_real_data,
+                                              bool verify) {
     // Validate preconditions.
     ASSERT(verif_block_size >= HashSize);
 
@@ -40,11 +65,21 @@ void IntegrityVerificationStorage::Initialize(VirtualFile hs, VirtualFile ds, s6
 
     // Set data.
     m_is_real_data = is_real_data;
+
+    // Set up the bitmap of verified blocks.
+    m_verify = verify;
+    if (m_verify) {
+        const s64 block_count =
+            Common::DivCeil(m_data_storage->GetSize(), static_cast<size_t>(verif_block_size));
+        m_verified_blocks.assign(Common::DivideUp(block_count, 64), 0);
+        m_verification_failures = 0;
+    }
 }
 
 void IntegrityVerificationStorage::Finalize() {
     m_hash_storage = VirtualFile();
     m_data_storage = VirtualFile();
+    m_verified_blocks.clear();
 }
 
 size_t IntegrityVerificationStorage::Read(u8* buffer, size_t size, size_t offset) const {
@@ -80,12 +115,117 @@ size_t IntegrityVerificationStorage::Read(u8* buffer, size_t size, size_t offset
         read_size = static_cast<size_t>(data_size - offset);
     }
 
-    // Perform the read.
-    return m_data_storage->Read(buffer, read_size, offset);
+    // Perform the read, if the blocks do not need to be verified.
+    if (!m_verify) {
+        return m_data_storage->Read(buffer, read_size, offset);
+    }
+    const s64 first_block = static_cast<s64>(offset) >> m_verification_block_order;
+    const s64 end_block =
+        static_cast<s64>(Common::AlignUp(offset + size, m_verification_block_size)) >>
+        m_verification_block_order;
+    {
+        std::scoped_lock lk{m_verify_mutex};
+        s64 block = first_block;
+        while (block < end_block && this->IsBlockVerified(block)) {
+            ++block;
+        }
+        if (block == end_block) {
+            return m_data_storage->Read(buffer, read_size, offset);
+        }
+    }
+
+    // Read the blocks whole, through a temporary buffer if the read is not block aligned.
+    const size_t aligned_offset = static_cast<size_t>(first_block) << m_verification_block_order;
+    const size_t aligned_size = static_cast<size_t>(end_block - first_block)
+                                << m_verification_block_order;
+    const bool is_aligned = aligned_offset == offset && aligned_size == size;
+    std::vector<u8> block_buffer(is_aligned ? 0 : aligned_size);
+    u8* const blocks = is_aligned ? buffer : block_buffer.data();
+
+    const size_t blocks_read_size =
+        std::min(aligned_size, static_cast<size_t>(data_size) - aligned_offset);
+    std::memset(blocks + blocks_read_size, 0, aligned_size - blocks_read_size);
+    const size_t blocks_result = m_data_storage->Read(blocks, blocks_read_size, aligned_offset);
+
+    // Verify the blocks, unless the read came up short.
+    const size_t skip_size = offset - aligned_offset;
+    if (blocks_result == blocks_read_size) {
+        this->VerifyBlocks(blocks, first_block, end_block - first_block);
+    } else {
+        read_size = blocks_result > skip_size ? std::min(read_size, blocks_result - skip_size) : 0;
+    }
+
+    // Copy the requested part.
+    if (!is_aligned) {
+        std::memcpy(buffer, blocks + skip_size, read_size);
+    }
+    return read_size;
 }
 
 size_t IntegrityVerificationStorage::GetSize() const {
     return m_data_storage->GetSize();
 }
 
+u64 IntegrityVerificationStorage::GetVerificationFailureCount() const {
+    std::scoped_lock lk{m_verify_mutex};
+    return m_verification_failures;
+}
+
+void IntegrityVerificationStorage::VerifyBlocks(const u8* buffer, s64 first_block,
+                                                s64 block_count) const {
+    // Read the expected hashes.
+    std::vector<BlockHash> hashes(static_cast<size_t>(block_count));
+    const size_t hashes_size = hashes.size() * sizeof(BlockHash);
+    if (m_hash_storage->Read(reinterpret_cast<u8*>(hashes.data()), hashes_size,
+                             static_cast<size_t>(first_block * HashSize)) != hashes_size) {
+        LOG_ERROR(Service_FS, "Failed to read the hashes of blocks {} to {}", first_block,
+                  first_block + block_count - 1);
+        return;
+    }
+
+    // Hash the blocks in chunks, shared with the verification workers for large reads.
+    std::vector<u8> matches(static_cast<size_t>(block_count));
+    const s64 chunk_count = Common::DivideUp(block_count, ParallelVerificationChunkBlocks);
+    std::atomic<s64> next_chunk{0};
+    const auto verify_chunks = [&] {
+        const size_t block_size = static_cast<size_t>(m_verification_block_size);
+        for (s64 chunk = next_chunk++; chunk < chunk_count; chunk = next_chunk++) {
+            const s64 begin = chunk * ParallelVerificationChunkBlocks;
+            const s64 end = std::min(begin + ParallelVerificationChunkBlocks, block_count);
+            for (s64 i = begin; i < end; ++i) {
+                const auto hash = Core::Crypto::SHA256Hasher::Hash(
+                    {buffer + (static_cast<size_t>(i) << m_verification_block_order),
+                     block_size});
+                matches[i] = std::memcmp(hash.data(), hashes[i].hash.data(), HashSize) == 0;
+            }
+        }
+    };
+
+    const auto helper_count = static_cast<std::ptrdiff_t>(
+        std::min<s64>(chunk_count - 1, static_cast<s64>(GetVerificationWorkerCount())));
+    std::latch helpers_done{helper_count};
+    for (std::ptrdiff_t i = 0; i < helper_count; ++i) {
+        GetVerificationWorkers().QueueWork([&] {
+            verify_chunks();
+            helpers_done.count_down();
+        });
+    }
+    verify_chunks();
+    helpers_done.wait();
+
+    // Mark the blocks as verified, so that each one is checked once.
+    std::scoped_lock lk{m_verify_mutex};
+    for (s64 i = 0; i < block_count; ++i) {
+        const s64 block = first_block + i;
+        if (this->IsBlockVerified(block)) {
+            continue;
+        }
+        m_verified_blocks[block / 64] |= 1ULL << (block % 64);
+        if (!matches[i]) {
+            ++m_verification_failures;
+            LOG_ERROR(Service_FS, "Integrity verification failed for block {}", block);
+        }
+    }
+}
+
 } // namespace FileSys
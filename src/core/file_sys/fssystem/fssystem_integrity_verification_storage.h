@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <mutex>
 #include <optional>
+#include <vector>
 
 #include "core/file_sys/fssystem/fs_i_storage.h"
 #include "core/file_sys/fssystem/fs_types.h"
@@ -30,8 +32,9 @@ public:
         this->Finalize();
     }
 
+    /// @param verify Whether blocks are checked against their hash the first time they are read
     void Initialize(VirtualFile hs, VirtualFile ds, s64 verif_block_size,
-                    s64 upper_layer_verif_block_size, bool is_real_data);
+                    s64 upper_layer_verif_block_size, bool is_real_data, bool verify = false);
     void Finalize();
 
     virtual size_t Read(u8* buffer, size_t size, size_t offset) const override;
@@ -41,6 +44,18 @@ public:
         return m_verification_block_size;
     }
 
+    /// Returns the number of blocks whose hash did not match since the storage was initialized.
+    u64 GetVerificationFailureCount() const;
+
+private:
+    /// Checks the blocks [first_block, first_block + block_count) held by buffer, hashing them in
+    /// parallel for large reads, and marks them as verified.
+    void VerifyBlocks(const u8* buffer, s64 first_block, s64 block_count) const;
+
+    bool IsBlockVerified(s64 block) const {
+        return (m_verified_blocks[block / 64] & (1ULL << (block % 64))) != 0;
+    }
+
 private:
     static void SetValidationBit(BlockHash* hash) {
         ASSERT(hash != nullptr);
@@ -60,6 +75,11 @@ private:
     s64 m_upper_layer_verification_block_size;
     s64 m_upper_layer_verification_block_order;
     bool m_is_real_data;
+    bool m_verify{};
+
+    mutable std::mutex m_verify_mutex;
+    mutable std::vector<u64> m_verified_blocks; ///< Bitmap of the blocks checked this session
+    mutable u64 m_verification_failures{};
 };
 
 } // namespace FileSys
@@ -1,10 +1,12 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "common/settings.h"
 #include "core/file_sys/fssystem/fssystem_aes_ctr_counter_extended_storage.h"
 #include "core/file_sys/fssystem/fssystem_aes_ctr_storage.h"
 #include "core/file_sys/fssystem/fssystem_aes_xts_storage.h"
 #include "core/file_sys/fssystem/fssystem_alignment_matching_storage.h"
+#include "core/file_sys/fssystem/fssystem_block_cache_storage.h"
 #include "core/file_sys/fssystem/fssystem_compressed_storage.h"
 #include "core/file_sys/fssystem/fssystem_hierarchical_integrity_verification_storage.h"
 #include "core/file_sys/fssystem/fssystem_hierarchical_sha256_storage.h"
@@ -67,6 +69,13 @@ using Sha256DataRegion = NcaFsHeader::Region;
 using IntegrityLevelInfo = NcaFsHeader::HashData::IntegrityMetaInfo::LevelHashInfo;
 using IntegrityDataInfo = IntegrityLevelInfo::HierarchicalIntegrityVerificationLevelInformation;
 
+/// Returns the block cache shared by all NCAs, sized to the current memory budget.
+std::shared_ptr<BlockCache> GetBlockCache() {
+    static const auto cache = std::make_shared<BlockCache>();
+    cache->SetCapacity(size_t{Settings::values.nca_block_cache_size.GetValue()} * 1_MiB);
+    return cache;
+}
+
 } // namespace
 
 Result NcaFileSystemDriver::OpenStorageWithContext(VirtualFile* out,
@@ -311,6 +320,11 @@ Result NcaFileSystemDriver::CreateStorageByRawStorage(VirtualFile* out,
         R_THROW(ResultInvalidNcaFsHeaderHashType);
     }
 
+    // Cache the decrypted and verified blocks.
+    if (Settings::values.nca_block_cache_size.GetValue() != 0) {
+        R_TRY(this->CreateBlockCacheStorage(std::addressof(storage), std::move(storage)));
+    }
+
     // Process compression layer.
     if (header_reader->ExistsCompressionLayer()) {
         R_TRY(this->CreateCompressedStorage(
@@ -1261,13 +1275,29 @@ Result NcaFileSystemDriver::CreateIntegrityVerificationStorageImpl(
     // Initialize the integrity storage.
     R_TRY(integrity_storage->Initialize(level_hash_info, meta_info.master_hash, storage_info,
                                         max_data_cache_entries, max_hash_cache_entries,
-                                        buffer_level));
+                                        buffer_level,
+                                        Settings::values.verify_nca_integrity.GetValue()));
 
     // Set the output.
     *out = std::move(integrity_storage);
     R_SUCCEED();
 }
 
+Result NcaFileSystemDriver::CreateBlockCacheStorage(VirtualFile* out, VirtualFile base_storage) {
+    // Validate preconditions.
+    ASSERT(out != nullptr);
+    ASSERT(base_storage != nullptr);
+
+    // Create the block cache storage.
+    auto cache_storage = std::make_shared<BlockCacheStorage>(std::move(base_storage),
+                                                             GetBlockCache());
+    R_UNLESS(cache_storage != nullptr, ResultAllocationMemoryFailedAllocateShared);
+
+    // Set the output.
+    *out = std::move(cache_storage);
+    R_SUCCEED();
+}
+
 Result NcaFileSystemDriver::CreateRegionSwitchStorage(VirtualFile* out,
                                                       const NcaFsHeaderReader* header_reader,
                                                       VirtualFile inside_storage,
@@ -343,6 +343,8 @@ private:
         const NcaFsHeader::HashData::IntegrityMetaInfo& meta_info, s64 layer_info_offset,
         int max_data_cache_entries, int max_hash_cache_entries, s8 buffer_level);
 
+    Result CreateBlockCacheStorage(VirtualFile* out, VirtualFile base_storage);
+
     Result CreateRegionSwitchStorage(VirtualFile* out, const NcaFsHeaderReader* header_reader,
                                      VirtualFile inside_storage, VirtualFile outside_storage);
 
@@ -2,15 +2,18 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <random>
 #include <regex>
-#include <mbedtls/sha256.h>
 #include "common/assert.h"
 #include "common/fs/path_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
 #include "common/scope_exit.h"
+#include "common/thread_worker.h"
 #include "core/crypto/key_manager.h"
+#include "core/crypto/sha_util.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/common_funcs.h"
 #include "core/file_sys/content_archive.h"
@@ -21,9 +24,75 @@
 #include "core/loader/loader.h"
 
 namespace FileSys {
+namespace {
 
-// The size of blocks to use when vfs raw copying into nand.
-constexpr size_t VFS_RC_LARGE_COPY_BLOCK = 0x400000;
+// Wraps the source of an install, hashing the data as the copy function reads it in order.
+class HashingVfsFile final : public VfsFile {
+public:
+    explicit HashingVfsFile(VirtualFile base_) : base(std::move(base_)) {}
+
+    std::string GetName() const override {
+        return base->GetName();
+    }
+
+    std::size_t GetSize() const override {
+        return base->GetSize();
+    }
+
+    bool Resize(std::size_t new_size) override {
+        return false;
+    }
+
+    VirtualDir GetContainingDirectory() const override {
+        return base->GetContainingDirectory();
+    }
+
+    bool IsWritable() const override {
+        return false;
+    }
+
+    bool IsReadable() const override {
+        return true;
+    }
+
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override {
+        const auto read = base->Read(data, length, offset);
+        if (offset == hashed_size) {
+            hasher.Update({data, read});
+            hashed_size += read;
+        }
+        return read;
+    }
+
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override {
+        return 0;
+    }
+
+    bool Rename(std::string_view name) override {
+        return false;
+    }
+
+    // Returns the hash of the file, reading the parts the copy function skipped or read out of
+    // order.
+    Core::Crypto::SHA256Hash GetHash() const {
+        std::vector<u8> buffer(VFS_RC_LARGE_COPY_BLOCK);
+        const auto size = GetSize();
+        while (hashed_size < size) {
+            const auto read_size = std::min(buffer.size(), size - hashed_size);
+            if (Read(buffer.data(), read_size, hashed_size) != read_size) {
+                break;
+            }
+        }
+        return hasher.Finalize();
+    }
+
+private:
+    VirtualFile base;
+    mutable Core::Crypto::SHA256Hasher hasher;
+    mutable std::size_t hashed_size = 0;
+};
+
+} // Anonymous namespace
 
 std::string ContentProviderEntry::DebugInfo() const {
     return fmt::format("title_id={:016X}, content_type={:02X}", title_id, static_cast<u8>(type));
@@ -63,8 +132,7 @@ static std::string GetRelativePathFromNcaID(const std::array<u8, 16>& nca_id, bo
         return fmt::format(format_str, Common::HexToString(nca_id, second_hex_upper));
     }
 
-    Core::Crypto::SHA256Hash hash{};
-    mbedtls_sha256_ret(nca_id.data(), nca_id.size(), hash.data(), 0);
+    const auto hash = Core::Crypto::SHA256Hasher::Hash(nca_id);
 
     const auto format_str =
         fmt::runtime(cnmt_suffix ? "/000000{:02X}/{}.cnmt.nca" : "/000000{:02X}/{}.nca");
@@ -145,8 +213,7 @@ bool PlaceholderCache::Create(const NcaID& id, u64 size) const {
         return false;
     }
 
-    Core::Crypto::SHA256Hash hash{};
-    mbedtls_sha256_ret(id.data(), id.size(), hash.data(), 0);
+    const auto hash = Core::Crypto::SHA256Hasher::Hash(id);
     const auto dirname = fmt::format("000000{:02X}", hash[0]);
 
     const auto dir2 = GetOrCreateDirectoryRelative(dir, dirname);
@@ -169,8 +236,7 @@ bool PlaceholderCache::Delete(const NcaID& id) const {
         return false;
     }
 
-    Core::Crypto::SHA256Hash hash{};
-    mbedtls_sha256_ret(id.data(), id.size(), hash.data(), 0);
+    const auto hash = Core::Crypto::SHA256Hasher::Hash(id);
     const auto dirname = fmt::format("000000{:02X}", hash[0]);
 
     const auto dir2 = GetOrCreateDirectoryRelative(dir, dirname);
@@ -614,6 +680,7 @@ InstallResult RegisteredCache::InstallEntry(const NSP& nsp, bool overwrite_if_ex
     }
 
     // Install all the other NCAs
+    std::vector<std::pair<std::shared_ptr<NCA>, ContentRecord>> content_ncas;
     for (const auto& record : cnmt.GetContentRecords()) {
         // Ignore DeltaFragments, they are not useful to us
         if (record.type == ContentRecordType::DeltaFragment) {
@@ -633,10 +700,11 @@ InstallResult RegisteredCache::InstallEntry(const NSP& nsp, bool overwrite_if_ex
             }
             continue;
         }
-        const auto nca_result = RawInstallNCA(*nca, copy, overwrite_if_exists, record.nca_id);
-        if (nca_result != InstallResult::Success) {
-            return nca_result;
-        }
+        content_ncas.emplace_back(nca, record);
+    }
+    const auto content_result = RawInstallContentNCAs(content_ncas, copy, overwrite_if_exists);
+    if (content_result != InstallResult::Success) {
+        return content_result;
     }
 
     Refresh();
@@ -665,7 +733,7 @@ InstallResult RegisteredCache::InstallEntry(const NCA& nca, TitleType type,
     const OptionalHeader opt_header{0, 0};
     ContentRecord c_rec{{}, {}, {}, GetCRTypeFromNCAType(nca.GetType()), {}};
     const auto& data = nca.GetBaseFile()->ReadBytes(0x100000);
-    mbedtls_sha256_ret(data.data(), data.size(), c_rec.hash.data(), 0);
+    c_rec.hash = Core::Crypto::SHA256Hasher::Hash(data);
     std::memcpy(&c_rec.nca_id, &c_rec.hash, 16);
     const CNMT new_cnmt(header, opt_header, {c_rec}, {});
     if (!RawInstallCitronMeta(new_cnmt)) {
@@ -776,10 +844,21 @@ InstallResult RegisteredCache::RawInstallNCA(const NCA& nca, const VfsCopyFuncti
         id = *override_id;
     } else {
         const auto& data = in->ReadBytes(0x100000);
-        mbedtls_sha256_ret(data.data(), data.size(), hash.data(), 0);
+        hash = Core::Crypto::SHA256Hasher::Hash(data);
         memcpy(id.data(), hash.data(), 16);
     }
 
+    VirtualFile out;
+    const auto create_result = CreateNCAFile(out, id, overwrite_if_exists);
+    if (create_result != InstallResult::Success) {
+        return create_result;
+    }
+    return copy(in, out, VFS_RC_LARGE_COPY_BLOCK) ? InstallResult::Success
+                                                  : InstallResult::ErrorCopyFailed;
+}
+
+InstallResult RegisteredCache::CreateNCAFile(VirtualFile& out, const NcaID& id,
+                                             bool overwrite_if_exists) {
     std::string path = GetRelativePathFromNcaID(id, false, true, false);
 
     if (GetFileAtID(id) != nullptr && !overwrite_if_exists) {
@@ -794,12 +873,163 @@ InstallResult RegisteredCache::RawInstallNCA(const NCA& nca, const VfsCopyFuncti
         c_dir->DeleteFile(Common::FS::GetFilename(path));
     }
 
-    auto out = dir->CreateFileRelative(path);
+    out = dir->CreateFileRelative(path);
     if (out == nullptr) {
         return InstallResult::ErrorCopyFailed;
     }
-    return copy(in, out, VFS_RC_LARGE_COPY_BLOCK) ? InstallResult::Success
-                                                  : InstallResult::ErrorCopyFailed;
+    return InstallResult::Success;
+}
+
+InstallResult RegisteredCache::RawInstallContentNCAs(
+    const std::vector<std::pair<std::shared_ptr<NCA>, ContentRecord>>& entries,
+    const VfsCopyFunction& copy, bool overwrite_if_exists) {
+    if (!overwrite_if_exists) {
+        for (const auto& [nca, record] : entries) {
+            if (GetFileAtID(record.nca_id) != nullptr) {
+                LOG_WARNING(Loader, "Attempting to overwrite existing NCA. Skipping...");
+                return InstallResult::ErrorAlreadyExists;
+            }
+        }
+    }
+
+    // Each NCA is copied to a temporary file next to its final path, and only replaces the
+    // installed one once every NCA was copied and verified. The directory operations are not
+    // thread safe, so the workers only create their files under the lock.
+    std::mutex dir_mutex;
+    std::vector<VirtualFile> outs(entries.size());
+    std::atomic<bool> failed{false};
+    const auto temp_path = [&entries](std::size_t i) {
+        return GetRelativePathFromNcaID(entries[i].second.nca_id, false, true, false) + ".tmp";
+    };
+
+    const auto install = [&](std::size_t i) {
+        if (failed) {
+            return;
+        }
+        {
+            std::scoped_lock lk{dir_mutex};
+            outs[i] = dir->CreateFileRelative(temp_path(i));
+        }
+        if (outs[i] == nullptr) {
+            failed = true;
+            return;
+        }
+
+        // Hash the NCA as it is read, so that it is only read once.
+        const auto& [nca, record] = entries[i];
+        const auto in = std::make_shared<HashingVfsFile>(nca->GetBaseFile());
+        if (!copy(in, outs[i], VFS_RC_LARGE_COPY_BLOCK)) {
+            failed = true;
+            return;
+        }
+        if (in->GetHash() != record.hash) {
+            LOG_ERROR(Loader, "Hash mismatch for NCA {}, the file is corrupted",
+                      Common::HexToString(record.nca_id, false));
+            failed = true;
+        }
+    };
+
+    if (entries.size() > 1) {
+        Common::ThreadWorker workers(std::min(entries.size(), VFS_RC_INSTALL_WORKERS),
+                                     "NCAInstall");
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            workers.QueueWork([&install, i] { install(i); });
+        }
+        workers.WaitForRequests();
+    } else if (!entries.empty()) {
+        install(0);
+    }
+
+    // Close the temporary files, as open files cannot be renamed or deleted on every host.
+    std::vector<VirtualDir> out_dirs(entries.size());
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        if (outs[i] != nullptr) {
+            out_dirs[i] = outs[i]->GetContainingDirectory();
+            outs[i].reset();
+        }
+    }
+    const auto remove_temp_files = [&] {
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            if (out_dirs[i] != nullptr) {
+                out_dirs[i]->DeleteFile(Common::FS::GetFilename(temp_path(i)));
+            }
+        }
+    };
+    if (failed) {
+        remove_temp_files();
+        return InstallResult::ErrorCopyFailed;
+    }
+
+    // Move the installed NCAs aside before any new one is moved into place, so that they can be
+    // restored if one of the renames fails.
+    const auto final_name = [&entries](std::size_t i) {
+        return std::string{Common::FS::GetFilename(
+            GetRelativePathFromNcaID(entries[i].second.nca_id, false, true, false))};
+    };
+    const auto old_name = [&](std::size_t i) { return final_name(i) + ".old"; };
+    const auto move_entry = [](const VirtualDir& parent, std::string_view from,
+                               std::string_view to) {
+        if (const auto file = parent->GetFile(from)) {
+            return file->Rename(to);
+        }
+        if (const auto subdir = parent->GetSubdirectory(from)) {
+            return subdir->Rename(to);
+        }
+        return false;
+    };
+    const auto delete_entry = [](const VirtualDir& parent, std::string_view name) {
+        if (parent->GetFile(name) != nullptr) {
+            parent->DeleteFile(name);
+        } else if (parent->GetSubdirectory(name) != nullptr) {
+            parent->DeleteSubdirectoryRecursive(name);
+        }
+    };
+
+    std::vector<bool> moved_aside(entries.size());
+    std::vector<bool> moved_in(entries.size());
+    const auto roll_back = [&] {
+        bool restored = true;
+        for (std::size_t i = 0; i < entries.size(); ++i) {
+            if (moved_in[i]) {
+                delete_entry(out_dirs[i], final_name(i));
+            }
+            if (moved_aside[i] && !move_entry(out_dirs[i], old_name(i), final_name(i))) {
+                LOG_ERROR(Loader, "Failed to restore NCA {}",
+                          Common::HexToString(entries[i].second.nca_id, false));
+                restored = false;
+            }
+        }
+        remove_temp_files();
+        return restored ? InstallResult::ErrorCopyFailed : InstallResult::ErrorPartialInstall;
+    };
+
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        if (GetFileAtID(entries[i].second.nca_id) == nullptr) {
+            continue;
+        }
+        LOG_WARNING(Loader, "Overwriting existing NCA...");
+        delete_entry(out_dirs[i], old_name(i));
+        if (!move_entry(out_dirs[i], final_name(i), old_name(i))) {
+            LOG_ERROR(Loader, "Failed to move aside NCA {}",
+                      Common::HexToString(entries[i].second.nca_id, false));
+            return roll_back();
+        }
+        moved_aside[i] = true;
+    }
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        if (!move_entry(out_dirs[i], Common::FS::GetFilename(temp_path(i)), final_name(i))) {
+            LOG_ERROR(Loader, "Failed to move NCA {} into place",
+                      Common::HexToString(entries[i].second.nca_id, false));
+            return roll_back();
+        }
+        moved_in[i] = true;
+    }
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        if (moved_aside[i]) {
+            delete_entry(out_dirs[i], old_name(i));
+        }
+    }
+    return InstallResult::Success;
 }
 
 bool RegisteredCache::RawInstallCitronMeta(const CNMT& cnmt) {
@@ -32,6 +32,12 @@ using NcaID = std::array<u8, 0x10>;
 using ContentProviderParsingFunction = std::function<VirtualFile(const VirtualFile&, const NcaID&)>;
 using VfsCopyFunction = std::function<bool(const VirtualFile&, const VirtualFile&, size_t)>;
 
+// The size of blocks to use when vfs raw copying into nand.
+constexpr size_t VFS_RC_LARGE_COPY_BLOCK = 0x400000;
+
+// The number of NCAs of a package that are copied into nand at once.
+constexpr size_t VFS_RC_INSTALL_WORKERS = 4;
+
 enum class InstallResult {
     Success,
     OverwriteExisting,
@@ -39,6 +45,8 @@ enum class InstallResult {
     ErrorCopyFailed,
     ErrorMetaFailed,
     ErrorBaseInstall,
+    // Some NCAs were replaced and the previous ones could not be restored.
+    ErrorPartialInstall,
 };
 
 struct ContentProviderEntry {
@@ -188,8 +196,16 @@ private:
     std::optional<NcaID> GetNcaIDFromMetadata(u64 title_id, ContentRecordType type) const;
     VirtualFile GetFileAtID(NcaID id) const;
     VirtualFile OpenFileOrDirectoryConcat(const VirtualDir& open_dir, std::string_view path) const;
+    InstallResult CreateNCAFile(VirtualFile& out, const NcaID& id, bool overwrite_if_exists);
     InstallResult RawInstallNCA(const NCA& nca, const VfsCopyFunction& copy,
                                 bool overwrite_if_exists, std::optional<NcaID> override_id = {});
+    // Copies the NCAs of content records on several threads, checking each one against the hash
+    // of its record while it is copied. Installed NCAs are only replaced once every copy was
+    // verified, and are moved aside until every new NCA is in place so that a failed rename can
+    // restore them. Returns ErrorPartialInstall if they could not be restored.
+    InstallResult RawInstallContentNCAs(
+        const std::vector<std::pair<std::shared_ptr<NCA>, ContentRecord>>& entries,
+        const VfsCopyFunction& copy, bool overwrite_if_exists);
     bool RawInstallCitronMeta(const CNMT& cnmt);
 
     VirtualDir dir;
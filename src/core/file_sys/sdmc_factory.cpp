@@ -32,6 +32,7 @@ VirtualDir SDMCFactory::GetSDMCModificationLoadRoot(u64 title_id) const {
     if (title_id == 0 || (title_id & 0xFFF) == 0x800) {
         return nullptr;
     }
+    std::scoped_lock lk{mod_root_mutex};
     return GetOrCreateDirectoryRelative(sd_mod_dir, fmt::format("/{:016X}", title_id));
 }
 
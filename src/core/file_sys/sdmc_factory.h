@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include "core/file_sys/vfs/vfs_types.h"
 #include "core/hle/result.h"
 
@@ -35,6 +36,9 @@ private:
     VirtualDir sd_dir;
     VirtualDir sd_mod_dir;
 
+    /// Serializes the creation of the per-title modification directories.
+    mutable std::mutex mod_root_mutex;
+
     std::unique_ptr<RegisteredCache> contents;
     std::unique_ptr<PlaceholderCache> placeholder;
 };
@@ -183,6 +183,10 @@ std::vector<u8> VfsFile::ReadAllBytes() const {
     return ReadBytes(GetSize());
 }
 
+std::span<const u8> VfsFile::GetMappedData() const {
+    return {};
+}
+
 bool VfsFile::WriteByte(u8 data, std::size_t offset) {
     return Write(&data, 1, offset) == 1;
 }
@@ -507,6 +511,18 @@ bool VfsRawCopy(const VirtualFile& src, const VirtualFile& dest, std::size_t blo
     if (!dest->Resize(src->GetSize()))
         return false;
 
+    // Mapped files are written straight from their mapping
+    const std::span<const u8> mapped = src->GetMappedData();
+    if (!mapped.empty() && mapped.size() == src->GetSize()) {
+        for (std::size_t i = 0; i < mapped.size(); i += block_size) {
+            const auto write = std::min(block_size, mapped.size() - i);
+            if (dest->Write(mapped.data() + i, write, i) != write) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     std::vector<u8> temp(std::min(block_size, src->GetSize()));
     for (std::size_t i = 0; i < src->GetSize(); i += block_size) {
         const auto read = std::min(block_size, src->GetSize() - i);
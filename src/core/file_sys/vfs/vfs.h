@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -118,6 +119,11 @@ public:
     // 0)'
     virtual std::vector<u8> ReadAllBytes() const;
 
+    // Returns the contents of the file when they are mapped in memory, so they can be used without
+    // copying them. Returns an empty span when the file can only be accessed with Read. The view is
+    // valid for the lifetime of the file.
+    virtual std::span<const u8> GetMappedData() const;
+
     // Reads an array of type T, size number_elements starting at offset.
     // Returns the number of bytes (sizeof(T)*number_elements) read successfully.
     template <typename T>
@@ -72,6 +72,14 @@ std::vector<u8> OffsetVfsFile::ReadAllBytes() const {
     return file->ReadBytes(size, offset);
 }
 
+std::span<const u8> OffsetVfsFile::GetMappedData() const {
+    const std::span<const u8> data = file->GetMappedData();
+    if (offset >= data.size()) {
+        return {};
+    }
+    return data.subspan(offset, std::min(size, data.size() - offset));
+}
+
 bool OffsetVfsFile::WriteByte(u8 data, std::size_t r_offset) {
     if (r_offset < size)
         return file->WriteByte(data, offset + r_offset);
@@ -3,12 +3,15 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <utility>
 #include "common/assert.h"
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
+#include "common/fs/fs_util.h"
 #include "common/fs/path_util.h"
+#include "common/literals.h"
 #include "common/logging/log.h"
 #include "core/file_sys/vfs/vfs.h"
 #include "core/file_sys/vfs/vfs_real.h"
@@ -30,8 +33,13 @@ namespace FS = Common::FS;
 
 namespace {
 
+using namespace Common::Literals;
+
 constexpr size_t MaxOpenFiles = 512;
 
+/// Smaller files are read with syscalls, mapping them costs more than it saves
+constexpr size_t MinMappedFileSize = 1_MiB;
+
 constexpr FS::FileAccessMode ModeFlagsToFileAccessMode(OpenMode mode) {
     switch (mode) {
     case OpenMode::Read:
@@ -194,10 +202,10 @@ bool RealVfsFilesystem::DeleteDirectory(std::string_view path_) {
     return FS::RemoveDirRecursively(path);
 }
 
-std::unique_lock<std::mutex> RealVfsFilesystem::RefreshReference(const std::string& path,
-                                                                 OpenMode perms,
-                                                                 FileReference& reference) {
-    std::unique_lock lk{list_lock};
+std::shared_ptr<FS::IOFile> RealVfsFilesystem::RefreshReference(const std::string& path,
+                                                                OpenMode perms,
+                                                                FileReference& reference) {
+    std::scoped_lock lk{list_lock};
 
     // Temporarily remove from list.
     this->RemoveReferenceFromListLocked(reference);
@@ -216,7 +224,7 @@ std::unique_lock<std::mutex> RealVfsFilesystem::RefreshReference(const std::stri
     // Reinsert into list.
     this->InsertReferenceIntoListLocked(reference);
 
-    return lk;
+    return reference.file;
 }
 
 void RealVfsFilesystem::DropReference(std::unique_ptr<FileReference>&& reference) {
@@ -290,14 +298,16 @@ std::size_t RealVfsFile::GetSize() const {
     if (size) {
         return *size;
     }
-    auto lk = base.RefreshReference(path, perms, *reference);
-    return reference->file ? reference->file->GetSize() : 0;
+    std::scoped_lock lk{io_mutex};
+    const auto file = base.RefreshReference(path, perms, *reference);
+    return file ? file->GetSize() : 0;
 }
 
 bool RealVfsFile::Resize(std::size_t new_size) {
     size.reset();
-    auto lk = base.RefreshReference(path, perms, *reference);
-    return reference->file ? reference->file->SetSize(new_size) : false;
+    std::scoped_lock lk{io_mutex};
+    const auto file = base.RefreshReference(path, perms, *reference);
+    return file ? file->SetSize(new_size) : false;
 }
 
 VirtualDir RealVfsFile::GetContainingDirectory() const {
@@ -313,20 +323,52 @@ bool RealVfsFile::IsReadable() const {
 }
 
 std::size_t RealVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
-    auto lk = base.RefreshReference(path, perms, *reference);
-    if (!reference->file || !reference->file->Seek(static_cast<s64>(offset))) {
+    if (const std::span<const u8> view = GetMappedData(); !view.empty()) {
+        if (offset >= view.size()) {
+            return 0;
+        }
+        const std::size_t read_size = std::min(length, view.size() - offset);
+        std::memcpy(data, view.data() + offset, read_size);
+        return read_size;
+    }
+    std::scoped_lock lk{io_mutex};
+    const auto file = base.RefreshReference(path, perms, *reference);
+    if (!file || !file->Seek(static_cast<s64>(offset))) {
         return 0;
     }
-    return reference->file->ReadSpan(std::span{data, length});
+    return file->ReadSpan(std::span{data, length});
+}
+
+std::span<const u8> RealVfsFile::GetMappedData() const {
+    std::call_once(map_flag, [this] { MapFile(); });
+    return mapped.Data();
+}
+
+void RealVfsFile::MapFile() const {
+    // Writable files can change size, which would invalidate the mapping
+    if (perms != OpenMode::Read) {
+        return;
+    }
+#ifdef ANDROID
+    // Content URIs can only be opened through file descriptors
+    if (path[0] != '/') {
+        return;
+    }
+#endif
+    if (GetSize() < MinMappedFileSize) {
+        return;
+    }
+    mapped.Open(FS::ToU8String(path));
 }
 
 std::size_t RealVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
     size.reset();
-    auto lk = base.RefreshReference(path, perms, *reference);
-    if (!reference->file || !reference->file->Seek(static_cast<s64>(offset))) {
+    std::scoped_lock lk{io_mutex};
+    const auto file = base.RefreshReference(path, perms, *reference);
+    if (!file || !file->Seek(static_cast<s64>(offset))) {
         return 0;
     }
-    return reference->file->WriteSpan(std::span{data, length});
+    return file->WriteSpan(std::span{data, length});
 }
 
 bool RealVfsFile::Rename(std::string_view name) {
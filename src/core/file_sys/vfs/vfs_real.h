@@ -7,6 +7,7 @@
 #include <mutex>
 #include <optional>
 #include <string_view>
+#include "common/fs/mapped_file.h"
 #include "common/intrusive_list.h"
 #include "core/file_sys/fs_filesystem.h"
 #include "core/file_sys/vfs/vfs.h"
@@ -55,8 +56,10 @@ private:
 
 private:
     friend class RealVfsFile;
-    std::unique_lock<std::mutex> RefreshReference(const std::string& path, OpenMode perms,
-                                                  FileReference& reference);
+    /// Reopens the file of a reference if it was evicted, and returns it. The file stays open
+    /// while the returned handle is held, even if the reference is evicted meanwhile.
+    std::shared_ptr<Common::FS::IOFile> RefreshReference(const std::string& path, OpenMode perms,
+                                                         FileReference& reference);
     void DropReference(std::unique_ptr<FileReference>&& reference);
 
 private:
@@ -86,6 +89,7 @@ public:
     bool IsReadable() const override;
     std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
     std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    std::span<const u8> GetMappedData() const override;
     bool Rename(std::string_view name) override;
 
 private:
@@ -93,6 +97,9 @@ private:
                 const std::string& path, OpenMode perms = OpenMode::Read,
                 std::optional<u64> size = {});
 
+    /// Maps large read-only files, so that reads bypass the shared file handles.
+    void MapFile() const;
+
     RealVfsFilesystem& base;
     std::unique_ptr<FileReference> reference;
     std::string path;
@@ -100,6 +107,11 @@ private:
     std::vector<std::string> path_components;
     std::optional<u64> size;
     OpenMode perms;
+    mutable std::once_flag map_flag;
+    mutable Common::FS::MappedFile mapped;
+    /// Serializes the seeks and transfers on the file handle, so that files are accessed in
+    /// parallel without holding the lock of the filesystem.
+    mutable std::mutex io_mutex;
 };
 
 // An implementation of VfsDirectory that represents a directory on the user's computer.
@@ -1099,6 +1099,7 @@ Result KServerSession::ReceiveRequest(uintptr_t server_message, uintptr_t server
     // Get the request and client thread.
     KSessionRequest* request;
     KThread* client_thread;
+    u32 num_queued_requests;
 
     {
         KScopedSchedulerLock sl{m_kernel};
@@ -1115,6 +1116,7 @@ Result KServerSession::ReceiveRequest(uintptr_t server_message, uintptr_t server
         // Pop the first request from the list.
         request = std::addressof(m_request_list.front());
         m_request_list.pop_front();
+        num_queued_requests = static_cast<u32>(m_request_list.size());
 
         // Get the thread for the request.
         client_thread = request->GetThread();
@@ -1146,9 +1148,17 @@ Result KServerSession::ReceiveRequest(uintptr_t server_message, uintptr_t server
         }
         Core::Memory::Memory& memory{client_thread->GetOwnerProcess()->GetMemory()};
         u32* cmd_buf{reinterpret_cast<u32*>(memory.GetPointer(client_message))};
-        *out_context =
-            std::make_shared<Service::HLERequestContext>(m_kernel, memory, this, client_thread);
+        // A session handles one request at a time, so the context of its previous request can
+        // be reused once nothing else holds on to it.
+        if (*out_context && out_context->use_count() == 1 &&
+            std::addressof((*out_context)->GetMemory()) == std::addressof(memory)) {
+            (*out_context)->Reset(client_thread);
+        } else {
+            *out_context = std::make_shared<Service::HLERequestContext>(m_kernel, memory, this,
+                                                                        client_thread);
+        }
         (*out_context)->SetSessionRequestManager(manager);
+        (*out_context)->SetQueueState(request->GetEnqueueTime(), num_queued_requests);
         (*out_context)->PopulateFromIncomingCommandBuffer(cmd_buf);
         // We succeeded.
         R_SUCCEED();
@@ -1343,6 +1353,7 @@ Result KServerSession::OnRequest(KSessionRequest* request) {
 
         // Add the request to the list.
         request->Open();
+        request->SetEnqueueTime(m_kernel.System().CoreTiming().GetGlobalTimeNs().count());
         m_request_list.push_back(*request);
 
         // If we were empty, signal.
@@ -216,6 +216,14 @@ public:
         m_server->Open();
     }
 
+    /// Returns the CoreTiming time in ns at which the request was queued on its server session.
+    s64 GetEnqueueTime() const {
+        return m_enqueue_time;
+    }
+    void SetEnqueueTime(s64 time) {
+        m_enqueue_time = time;
+    }
+
     void ClearThread() {
         m_thread = nullptr;
     }
@@ -310,6 +318,7 @@ private:
     KEvent* m_event{};
     uintptr_t m_address{};
     size_t m_size{};
+    s64 m_enqueue_time{};
 };
 
 } // namespace Kernel
@@ -1041,6 +1041,13 @@ void KernelCore::RegisterHostThread(KThread* existing_thread) {
     }
 }
 
+static Svc::CreateProcessParameter MakeServiceProcessParameter(std::string_view process_name) {
+    // Name the process after the service, truncated to the length the kernel stores.
+    Svc::CreateProcessParameter params{};
+    process_name.copy(params.name.data(), params.name.size());
+    return params;
+}
+
 static std::jthread RunHostThreadFunc(KernelCore& kernel, KProcess* process,
                                       std::string&& thread_name, std::function<void()>&& func) {
     // Reserve a new thread from the process resource limit.
@@ -1078,8 +1085,8 @@ std::jthread KernelCore::RunOnHostCoreProcess(std::string&& process_name,
                                               std::function<void()> func) {
     // Make a new process.
     KProcess* process = KProcess::Create(*this);
-    ASSERT(R_SUCCEEDED(
-        process->Initialize(Svc::CreateProcessParameter{}, GetSystemResourceLimit(), false)));
+    ASSERT(R_SUCCEEDED(process->Initialize(MakeServiceProcessParameter(process_name),
+                                           GetSystemResourceLimit(), false)));
 
     // Ensure that we don't hold onto any extra references.
     SCOPE_EXIT {
@@ -1108,8 +1115,8 @@ void KernelCore::RunOnGuestCoreProcess(std::string&& process_name, std::function
 
     // Make a new process.
     KProcess* process = KProcess::Create(*this);
-    ASSERT(R_SUCCEEDED(
-        process->Initialize(Svc::CreateProcessParameter{}, GetSystemResourceLimit(), false)));
+    ASSERT(R_SUCCEEDED(process->Initialize(MakeServiceProcessParameter(process_name),
+                                           GetSystemResourceLimit(), false)));
 
     // Ensure that we don't hold onto any extra references.
     SCOPE_EXIT {
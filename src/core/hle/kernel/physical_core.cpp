@@ -10,6 +10,7 @@
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/physical_core.h"
 #include "core/hle/kernel/svc.h"
+#include "core/tools/guest_profiler.h"
 
 namespace Kernel {
 
@@ -97,6 +98,15 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
             ExitContext();
         }
 
+        // Record a profiler sample if one was requested while the thread was running.
+        bool sampled = false;
+        if (auto* profiler = m_sample_profiler.exchange(nullptr, std::memory_order_acquire)) {
+            Svc::ThreadContext ctx{};
+            interface->GetContext(ctx);
+            profiler->RecordGuestSample(*process, ctx);
+            sampled = true;
+        }
+
         // Determine why we stopped.
         const bool supervisor_call = True(hr & Core::HaltReason::SupervisorCall);
         const bool prefetch_abort = True(hr & Core::HaltReason::PrefetchAbort);
@@ -133,11 +143,26 @@ void PhysicalCore::RunThread(Kernel::KThread* thread) {
 
         // Handle system calls.
         if (supervisor_call) {
+            const u32 svc = interface->GetSvcNumber();
+
+            // Mark the call for the profiler. The thread may be on another core when it returns.
+            m_svc_number.store(svc, std::memory_order_relaxed);
+            m_svc_thread.store(thread, std::memory_order_release);
+
             // Perform call.
-            Svc::Call(system, interface->GetSvcNumber());
+            Svc::Call(system, svc);
+
+            const KThread* expected = thread;
+            m_svc_thread.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed);
             return;
         }
 
+        // Resume the thread if it was only halted to be sampled.
+        if (sampled && hr == Core::HaltReason::BreakLoop && !m_is_single_core &&
+            !IsInterrupted()) {
+            continue;
+        }
+
         // Handle external interrupt sources.
         if (interrupt || m_is_single_core) {
             return;
@@ -235,6 +260,35 @@ void PhysicalCore::Interrupt() {
     arm_interface->SignalInterrupt(thread);
 }
 
+bool PhysicalCore::RequestSample(Tools::GuestProfiler& profiler) {
+    // Lock core context.
+    std::scoped_lock lk{m_guard};
+
+    // If there is no guest code running, there is nothing to sample.
+    if (m_arm_interface == nullptr) {
+        return false;
+    }
+
+    // Halt the CPU, the sample is recorded by the core when it stops.
+    m_sample_profiler.store(std::addressof(profiler), std::memory_order_release);
+    m_arm_interface->SignalInterrupt(m_current_thread);
+    return true;
+}
+
+void PhysicalCore::CancelSample() {
+    m_sample_profiler.store(nullptr, std::memory_order_release);
+}
+
+std::optional<u32> PhysicalCore::GetCurrentSvc() const {
+    // The call only counts while its thread is the one scheduled on this core.
+    const KThread* svc_thread = m_svc_thread.load(std::memory_order_acquire);
+    if (svc_thread == nullptr ||
+        svc_thread != m_kernel.Scheduler(m_core_index).GetSchedulerCurrentThread()) {
+        return std::nullopt;
+    }
+    return m_svc_number.load(std::memory_order_relaxed);
+}
+
 void PhysicalCore::ClearInterrupt() {
     std::scoped_lock lk{m_guard};
     m_is_interrupted = false;
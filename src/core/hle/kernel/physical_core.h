@@ -3,10 +3,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <cstddef>
 #include <memory>
 #include <mutex>
+#include <optional>
 
 #include "core/arm/arm_interface.h"
 
@@ -19,6 +21,10 @@ class ExclusiveMonitor;
 class System;
 } // namespace Core
 
+namespace Tools {
+class GuestProfiler;
+} // namespace Tools
+
 namespace Kernel {
 
 class PhysicalCore {
@@ -58,6 +64,16 @@ public:
     // Check if this core is interrupted.
     bool IsInterrupted() const;
 
+    // Request a profiler sample of the guest code running on this core.
+    // Returns false if the core is not running guest code.
+    bool RequestSample(Tools::GuestProfiler& profiler);
+
+    // Drop a sample request that was not recorded yet.
+    void CancelSample();
+
+    // Get the supervisor call the current thread of this core is performing, if any.
+    std::optional<u32> GetCurrentSvc() const;
+
     std::size_t CoreIndex() const {
         return m_core_index;
     }
@@ -72,6 +88,11 @@ private:
     KThread* m_current_thread{};
     bool m_is_interrupted{};
     bool m_is_single_core{};
+
+    // Profiler state
+    std::atomic<Tools::GuestProfiler*> m_sample_profiler{};
+    std::atomic<const KThread*> m_svc_thread{};
+    std::atomic<u32> m_svc_number{};
 };
 
 } // namespace Kernel
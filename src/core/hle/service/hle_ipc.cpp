@@ -134,6 +134,40 @@ HLERequestContext::HLERequestContext(Kernel::KernelCore& kernel_, Core::Memory::
 
 HLERequestContext::~HLERequestContext() = default;
 
+void HLERequestContext::Reset(Kernel::KThread* thread_) {
+    cmd_buf[0] = 0;
+    client_handle_table = nullptr;
+    thread = thread_;
+
+    incoming_move_handles.clear();
+    incoming_copy_handles.clear();
+    outgoing_move_objects.clear();
+    outgoing_copy_objects.clear();
+    outgoing_domain_objects.clear();
+
+    command_header.reset();
+    handle_descriptor_header.reset();
+    data_payload_header.reset();
+    domain_message_header.reset();
+    buffer_x_descriptors.clear();
+    buffer_a_descriptors.clear();
+    buffer_b_descriptors.clear();
+    buffer_w_descriptors.clear();
+    buffer_c_descriptors.clear();
+
+    command = 0;
+    pid = 0;
+    write_size = 0;
+    data_payload_offset = 0;
+    handles_offset = 0;
+    domain_offset = 0;
+    enqueue_time = 0;
+    num_queued_requests = 0;
+
+    manager.reset();
+    is_deferred = false;
+}
+
 void HLERequestContext::ParseCommandBuffer(u32_le* src_cmdbuf, bool incoming) {
     IPC::RequestParser rp(src_cmdbuf);
     command_header = rp.PopRaw<IPC::CommandHeader>();
@@ -315,23 +349,10 @@ Result HLERequestContext::WriteToOutgoingCommandBuffer() {
 }
 
 std::vector<u8> HLERequestContext::ReadBufferCopy(std::size_t buffer_index) const {
-    const bool is_buffer_a{BufferDescriptorA().size() > buffer_index &&
-                           BufferDescriptorA()[buffer_index].Size()};
-    if (is_buffer_a) {
-        ASSERT_OR_EXECUTE_MSG(
-            BufferDescriptorA().size() > buffer_index, { return {}; },
-            "BufferDescriptorA invalid buffer_index {}", buffer_index);
-        std::vector<u8> buffer(BufferDescriptorA()[buffer_index].Size());
-        memory.ReadBlock(BufferDescriptorA()[buffer_index].Address(), buffer.data(), buffer.size());
-        return buffer;
-    } else {
-        ASSERT_OR_EXECUTE_MSG(
-            BufferDescriptorX().size() > buffer_index, { return {}; },
-            "BufferDescriptorX invalid buffer_index {}", buffer_index);
-        std::vector<u8> buffer(BufferDescriptorX()[buffer_index].Size());
-        memory.ReadBlock(BufferDescriptorX()[buffer_index].Address(), buffer.data(), buffer.size());
-        return buffer;
-    }
+    // Copy straight from guest memory when the buffer is contiguous, instead of zero filling the
+    // result and reading into it.
+    const auto buffer = ReadBuffer(buffer_index);
+    return std::vector<u8>(buffer.begin(), buffer.end());
 }
 
 std::span<const u8> HLERequestContext::ReadBufferA(std::size_t buffer_index) const {
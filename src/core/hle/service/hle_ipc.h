@@ -12,6 +12,8 @@
 #include <type_traits>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/concepts.h"
@@ -185,6 +187,12 @@ public:
                                Kernel::KServerSession* session, Kernel::KThread* thread);
     ~HLERequestContext();
 
+    /**
+     * Clears the state of the previous request so that this context can be reused for another
+     * request on the same session, keeping the storage it already allocated.
+     */
+    void Reset(Kernel::KThread* thread_);
+
     /// Returns a pointer to the IPC command buffer for this request.
     [[nodiscard]] u32* CommandBuffer() {
         return cmd_buf.data();
@@ -233,20 +241,20 @@ public:
         return data_payload_offset;
     }
 
-    [[nodiscard]] const std::vector<IPC::BufferDescriptorX>& BufferDescriptorX() const {
-        return buffer_x_descriptors;
+    [[nodiscard]] std::span<const IPC::BufferDescriptorX> BufferDescriptorX() const {
+        return {buffer_x_descriptors.data(), buffer_x_descriptors.size()};
     }
 
-    [[nodiscard]] const std::vector<IPC::BufferDescriptorABW>& BufferDescriptorA() const {
-        return buffer_a_descriptors;
+    [[nodiscard]] std::span<const IPC::BufferDescriptorABW> BufferDescriptorA() const {
+        return {buffer_a_descriptors.data(), buffer_a_descriptors.size()};
     }
 
-    [[nodiscard]] const std::vector<IPC::BufferDescriptorABW>& BufferDescriptorB() const {
-        return buffer_b_descriptors;
+    [[nodiscard]] std::span<const IPC::BufferDescriptorABW> BufferDescriptorB() const {
+        return {buffer_b_descriptors.data(), buffer_b_descriptors.size()};
     }
 
-    [[nodiscard]] const std::vector<IPC::BufferDescriptorC>& BufferDescriptorC() const {
-        return buffer_c_descriptors;
+    [[nodiscard]] std::span<const IPC::BufferDescriptorC> BufferDescriptorC() const {
+        return {buffer_c_descriptors.data(), buffer_c_descriptors.size()};
     }
 
     [[nodiscard]] const IPC::DomainMessageHeader& GetDomainMessageHeader() const {
@@ -381,6 +389,21 @@ public:
         return manager.lock();
     }
 
+    /// Returns the CoreTiming time in ns at which the client sent this request.
+    [[nodiscard]] s64 GetEnqueueTime() const {
+        return enqueue_time;
+    }
+
+    /// Returns the number of requests of the session that were queued behind this one.
+    [[nodiscard]] u32 GetNumQueuedRequests() const {
+        return num_queued_requests;
+    }
+
+    void SetQueueState(s64 enqueue_time_, u32 num_queued_requests_) {
+        enqueue_time = enqueue_time_;
+        num_queued_requests = num_queued_requests_;
+    }
+
     bool GetIsDeferred() const {
         return is_deferred;
     }
@@ -399,22 +422,27 @@ private:
     Kernel::KHandleTable* client_handle_table{};
     Kernel::KThread* thread{};
 
-    std::vector<Handle> incoming_move_handles;
-    std::vector<Handle> incoming_copy_handles;
+    // Requests rarely carry more than a few handles or descriptors of each kind, so these are
+    // stored inline to keep request parsing free of heap allocations.
+    template <typename T>
+    using InlineVector = boost::container::small_vector<T, 4>;
+
+    InlineVector<Handle> incoming_move_handles;
+    InlineVector<Handle> incoming_copy_handles;
 
-    std::vector<Kernel::KAutoObject*> outgoing_move_objects;
-    std::vector<Kernel::KAutoObject*> outgoing_copy_objects;
-    std::vector<SessionRequestHandlerPtr> outgoing_domain_objects;
+    InlineVector<Kernel::KAutoObject*> outgoing_move_objects;
+    InlineVector<Kernel::KAutoObject*> outgoing_copy_objects;
+    InlineVector<SessionRequestHandlerPtr> outgoing_domain_objects;
 
     std::optional<IPC::CommandHeader> command_header;
     std::optional<IPC::HandleDescriptorHeader> handle_descriptor_header;
     std::optional<IPC::DataPayloadHeader> data_payload_header;
     std::optional<IPC::DomainMessageHeader> domain_message_header;
-    std::vector<IPC::BufferDescriptorX> buffer_x_descriptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_a_descriptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_b_descriptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_w_descriptors;
-    std::vector<IPC::BufferDescriptorC> buffer_c_descriptors;
+    InlineVector<IPC::BufferDescriptorX> buffer_x_descriptors;
+    InlineVector<IPC::BufferDescriptorABW> buffer_a_descriptors;
+    InlineVector<IPC::BufferDescriptorABW> buffer_b_descriptors;
+    InlineVector<IPC::BufferDescriptorABW> buffer_w_descriptors;
+    InlineVector<IPC::BufferDescriptorC> buffer_c_descriptors;
 
     u32_le command{};
     u64 pid{};
@@ -422,6 +450,8 @@ private:
     u32 data_payload_offset{};
     u32 handles_offset{};
     u32 domain_offset{};
+    s64 enqueue_time{};
+    u32 num_queued_requests{};
 
     std::weak_ptr<SessionRequestManager> manager{};
     bool is_deferred{false};
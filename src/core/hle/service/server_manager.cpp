@@ -2,20 +2,25 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/scope_exit.h"
+#include "common/settings.h"
 
 #include "core/core.h"
+#include "core/core_timing.h"
 #include "core/hle/kernel/k_client_port.h"
 #include "core/hle/kernel/k_client_session.h"
 #include "core/hle/kernel/k_event.h"
 #include "core/hle/kernel/k_object_name.h"
 #include "core/hle/kernel/k_port.h"
+#include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/k_server_port.h"
 #include "core/hle/kernel/k_server_session.h"
 #include "core/hle/kernel/k_synchronization_object.h"
+#include "core/hle/kernel/k_thread.h"
 #include "core/hle/kernel/svc_results.h"
 #include "core/hle/service/hle_ipc.h"
 #include "core/hle/service/ipc_helpers.h"
 #include "core/hle/service/server_manager.h"
+#include "core/hle/service/service_statistics.h"
 #include "core/hle/service/sm/sm.h"
 
 namespace Service {
@@ -71,6 +76,12 @@ private:
 };
 
 ServerManager::ServerManager(Core::System& system) : m_system{system}, m_selection_mutex{system} {
+    // Servers are created by the process running them. The name is set before any host thread
+    // starts, as every thread reads it when recording queue statistics.
+    if (const auto* process = Kernel::GetCurrentProcessPointer(system.Kernel())) {
+        m_name = process->GetName();
+    }
+
     // Initialize event.
     m_wakeup_event = Kernel::KEvent::Create(system.Kernel());
     m_wakeup_event->Initialize(nullptr);
@@ -236,7 +247,7 @@ Result ServerManager::ManageDeferral(Kernel::KEvent** out_event) {
 
 void ServerManager::StartAdditionalHostThreads(const char* name, size_t num_threads) {
     for (size_t i = 0; i < num_threads; i++) {
-        auto thread_name = fmt::format("{}:{}", name, i + 1);
+        auto thread_name = fmt::format("{}:{}", name, m_threads.size() + 1);
         m_threads.emplace_back(m_system.Kernel().RunOnHostCoreThread(
             std::move(thread_name), [&] { this->LoopProcessImpl(); }));
     }
@@ -247,6 +258,18 @@ Result ServerManager::LoopProcess() {
         m_stopped.Set();
     };
 
+    auto& kernel = m_system.Kernel();
+
+    // Servers running on host threads can handle the requests of several sessions at once. Each
+    // session still handles its requests in order, as it is only waited on again once its
+    // current request completes.
+    if (Kernel::GetCurrentThread(kernel).IsDummyThread()) {
+        const size_t num_threads = Settings::values.service_host_threads.GetValue();
+        if (m_threads.size() + 1 < num_threads) {
+            this->StartAdditionalHostThreads(m_name.c_str(), num_threads - m_threads.size() - 1);
+        }
+    }
+
     R_RETURN(this->LoopProcessImpl());
 }
 
@@ -355,10 +378,26 @@ Result ServerManager::OnSessionEvent(Session* session) {
 
     R_ASSERT(res);
 
+    if (Settings::values.record_service_statistics) {
+        this->RecordQueueStatistics(*session->GetContext());
+    }
+
     // Complete the sync request with deferral handling.
     R_RETURN(this->CompleteSyncRequest(session));
 }
 
+void ServerManager::RecordQueueStatistics(const HLERequestContext& context) {
+    QueueStatistics* statistics = m_queue_statistics.load(std::memory_order_relaxed);
+    if (statistics == nullptr) {
+        statistics = &m_system.GetServiceStatistics().GetQueue(m_name);
+        m_queue_statistics.store(statistics, std::memory_order_relaxed);
+    }
+
+    const s64 wait_time = m_system.CoreTiming().GetGlobalTimeNs().count() -
+                          context.GetEnqueueTime();
+    statistics->Record(std::chrono::nanoseconds{wait_time}, context.GetNumQueuedRequests());
+}
+
 Result ServerManager::CompleteSyncRequest(Session* session) {
     Result res = ResultSuccess;
     Result service_res = ResultSuccess;
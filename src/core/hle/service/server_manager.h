@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <mutex>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "common/polyfill_thread.h"
@@ -28,6 +30,7 @@ class KServerSession;
 namespace Service {
 
 class Port;
+class QueueStatistics;
 class Session;
 
 class ServerManager {
@@ -64,6 +67,7 @@ private:
     Result OnSessionEvent(Session* session);
     Result OnDeferralEvent();
     Result CompleteSyncRequest(Session* session);
+    void RecordQueueStatistics(const HLERequestContext& context);
 
 private:
     void DestroySession(Session* session);
@@ -72,6 +76,10 @@ private:
     Core::System& m_system;
     Mutex m_selection_mutex;
 
+    // Name of the process running this server, used for its threads and statistics
+    std::string m_name{};
+    std::atomic<QueueStatistics*> m_queue_statistics{};
+
     // Events
     Kernel::KEvent* m_wakeup_event{};
     Kernel::KEvent* m_deferral_event{};
@@ -5,11 +5,13 @@
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
+#include "common/steady_clock.h"
 #include "core/core.h"
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/service/ipc_helpers.h"
 #include "core/hle/service/service.h"
+#include "core/hle/service/service_statistics.h"
 #include "core/hle/service/sm/sm.h"
 #include "core/reporter.h"
 
@@ -42,22 +44,51 @@ ServiceFrameworkBase::~ServiceFrameworkBase() {
     const auto guard = LockService();
 }
 
-void ServiceFrameworkBase::RegisterHandlersBase(const FunctionInfoBase* functions, std::size_t n) {
+void ServiceFrameworkBase::HandlerTable::Register(const FunctionInfoBase* functions,
+                                                  std::size_t n) {
     handlers.reserve(handlers.size() + n);
     for (std::size_t i = 0; i < n; ++i) {
         // Usually this array is sorted by id already, so hint to insert at the end
         handlers.emplace_hint(handlers.cend(), functions[i].expected_header, functions[i]);
     }
+
+    dense_index.clear();
+    for (std::size_t i = 0; i < handlers.size(); ++i) {
+        const u32 command = handlers.nth(i)->first;
+        if (command >= DenseCommandLimit) {
+            break;
+        }
+        dense_index.resize(command + 1);
+        dense_index[command] = static_cast<u16>(i + 1);
+    }
+    statistics = std::vector<std::atomic<CommandStatistics*>>(handlers.size());
+}
+
+std::optional<std::size_t> ServiceFrameworkBase::HandlerTable::Find(u32 command) const {
+    if (command < dense_index.size()) {
+        const u16 position = dense_index[command];
+        if (position == 0) {
+            return std::nullopt;
+        }
+        return position - 1;
+    }
+    if (command < DenseCommandLimit) {
+        return std::nullopt;
+    }
+    const auto itr = handlers.find(command);
+    if (itr == handlers.end()) {
+        return std::nullopt;
+    }
+    return handlers.index_of(itr);
+}
+
+void ServiceFrameworkBase::RegisterHandlersBase(const FunctionInfoBase* functions, std::size_t n) {
+    handlers.Register(functions, n);
 }
 
 void ServiceFrameworkBase::RegisterHandlersBaseTipc(const FunctionInfoBase* functions,
                                                     std::size_t n) {
-    handlers_tipc.reserve(handlers_tipc.size() + n);
-    for (std::size_t i = 0; i < n; ++i) {
-        // Usually this array is sorted by id already, so hint to insert at the end
-        handlers_tipc.emplace_hint(handlers_tipc.cend(), functions[i].expected_header,
-                                   functions[i]);
-    }
+    handlers_tipc.Register(functions, n);
 }
 
 void ServiceFrameworkBase::ReportUnimplementedFunction(HLERequestContext& ctx,
@@ -83,29 +114,39 @@ void ServiceFrameworkBase::ReportUnimplementedFunction(HLERequestContext& ctx,
     }
 }
 
-void ServiceFrameworkBase::InvokeRequest(HLERequestContext& ctx) {
-    auto itr = handlers.find(ctx.GetCommand());
-    const FunctionInfoBase* info = itr == handlers.end() ? nullptr : &itr->second;
+void ServiceFrameworkBase::InvokeHandler(HLERequestContext& ctx, HandlerTable& table,
+                                         bool is_tipc) {
+    const auto position = table.Find(ctx.GetCommand());
+    const FunctionInfoBase* info = position ? &table.handlers.nth(*position)->second : nullptr;
     if (info == nullptr || info->handler_callback == nullptr) {
         return ReportUnimplementedFunction(ctx, info);
     }
 
     LOG_TRACE(Service, "{}", MakeFunctionString(info->name, GetServiceName(), ctx.CommandBuffer()));
-    handler_invoker(this, info->handler_callback, ctx);
-}
-
-void ServiceFrameworkBase::InvokeRequestTipc(HLERequestContext& ctx) {
-    boost::container::flat_map<u32, FunctionInfoBase>::iterator itr;
-
-    itr = handlers_tipc.find(ctx.GetCommand());
+    if (!Settings::values.record_service_statistics.GetValue()) {
+        handler_invoker(this, info->handler_callback, ctx);
+        return;
+    }
 
-    const FunctionInfoBase* info = itr == handlers_tipc.end() ? nullptr : &itr->second;
-    if (info == nullptr || info->handler_callback == nullptr) {
-        return ReportUnimplementedFunction(ctx, info);
+    auto& cached_statistics = table.statistics[*position];
+    CommandStatistics* statistics = cached_statistics.load(std::memory_order_relaxed);
+    if (statistics == nullptr) {
+        statistics = &system.GetServiceStatistics().GetCommand(service_name, is_tipc,
+                                                               info->expected_header, info->name);
+        cached_statistics.store(statistics, std::memory_order_relaxed);
     }
 
-    LOG_TRACE(Service, "{}", MakeFunctionString(info->name, GetServiceName(), ctx.CommandBuffer()));
+    const auto start = Common::SteadyClock::Now();
     handler_invoker(this, info->handler_callback, ctx);
+    statistics->Record(Common::SteadyClock::Now() - start);
+}
+
+void ServiceFrameworkBase::InvokeRequest(HLERequestContext& ctx) {
+    InvokeHandler(ctx, handlers, false);
+}
+
+void ServiceFrameworkBase::InvokeRequestTipc(HLERequestContext& ctx) {
+    InvokeHandler(ctx, handlers_tipc, true);
 }
 
 Result ServiceFrameworkBase::HandleSyncRequest(Kernel::KServerSession& session,
@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <vector>
 #include <boost/container/flat_map.hpp>
 #include "common/common_types.h"
 #include "core/hle/service/hle_ipc.h"
@@ -32,6 +35,8 @@ namespace SM {
 class ServiceManager;
 }
 
+class CommandStatistics;
+
 /// Default number of maximum connections to a server session.
 static constexpr u32 ServerSessionCountMax = 0x40;
 static_assert(ServerSessionCountMax == 0x40,
@@ -101,8 +106,26 @@ private:
                                   u32 max_sessions_, InvokerFn* handler_invoker_);
     ~ServiceFrameworkBase() override;
 
+    /// Handlers of one of the protocols, with constant time lookup of the usual small command IDs.
+    struct HandlerTable {
+        /// Commands below this ID are found through dense_index instead of a binary search.
+        static constexpr u32 DenseCommandLimit = 1024;
+
+        void Register(const FunctionInfoBase* functions, std::size_t n);
+
+        /// Returns the position of the handler of a command in handlers, if there is one.
+        [[nodiscard]] std::optional<std::size_t> Find(u32 command) const;
+
+        boost::container::flat_map<u32, FunctionInfoBase> handlers;
+        /// Position in handlers plus one of each command below DenseCommandLimit, zero if none.
+        std::vector<u16> dense_index;
+        /// Statistics of each handler, looked up on its first call while they are recorded.
+        std::vector<std::atomic<CommandStatistics*>> statistics;
+    };
+
     void RegisterHandlersBase(const FunctionInfoBase* functions, std::size_t n);
     void RegisterHandlersBaseTipc(const FunctionInfoBase* functions, std::size_t n);
+    void InvokeHandler(HLERequestContext& ctx, HandlerTable& table, bool is_tipc);
     void ReportUnimplementedFunction(HLERequestContext& ctx, const FunctionInfoBase* info);
 
     /// Maximum number of concurrent sessions that this service can handle.
@@ -114,8 +137,8 @@ private:
 
     /// Function used to safely up-cast pointers to the derived class before invoking a handler.
     InvokerFn* handler_invoker;
-    boost::container::flat_map<u32, FunctionInfoBase> handlers;
-    boost::container::flat_map<u32, FunctionInfoBase> handlers_tipc;
+    HandlerTable handlers;
+    HandlerTable handlers_tipc;
 
     /// Used to gain exclusive access to the service members, e.g. from CoreTiming thread.
     std::mutex lock_service;
@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <bit>
+#include <vector>
+
+#include "common/logging/log.h"
+#include "core/hle/service/service_statistics.h"
+
+namespace Service {
+
+namespace {
+
+template <typename T>
+void StoreMax(std::atomic<T>& max, T value) {
+    T current_max = max.load(std::memory_order_relaxed);
+    while (value > current_max &&
+           !max.compare_exchange_weak(current_max, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // Anonymous namespace
+
+void CommandStatistics::Record(std::chrono::nanoseconds latency) {
+    const u64 ns = static_cast<u64>(std::max<s64>(latency.count(), 1));
+    const size_t bucket = std::min<size_t>(std::bit_width(ns) - 1, NumBuckets - 1);
+
+    count.fetch_add(1, std::memory_order_relaxed);
+    total_ns.fetch_add(ns, std::memory_order_relaxed);
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    StoreMax(max_ns, ns);
+}
+
+void CommandStatistics::Clear() {
+    count.store(0, std::memory_order_relaxed);
+    total_ns.store(0, std::memory_order_relaxed);
+    max_ns.store(0, std::memory_order_relaxed);
+    for (auto& bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::chrono::nanoseconds CommandStatistics::GetPercentile(double percentile) const {
+    const u64 total_count = GetCount();
+    if (total_count == 0) {
+        return {};
+    }
+    const u64 target = std::max<u64>(static_cast<u64>(percentile * total_count), 1);
+    u64 accumulated = 0;
+    for (size_t i = 0; i < NumBuckets - 1; i++) {
+        accumulated += GetBucket(i);
+        if (accumulated >= target) {
+            return std::min(std::chrono::nanoseconds{u64{2} << i}, GetMax());
+        }
+    }
+    return GetMax();
+}
+
+void QueueStatistics::Record(std::chrono::nanoseconds wait_time, u32 queue_depth) {
+    const u64 wait_ns = static_cast<u64>(std::max<s64>(wait_time.count(), 0));
+    count.fetch_add(1, std::memory_order_relaxed);
+    total_wait_ns.fetch_add(wait_ns, std::memory_order_relaxed);
+    total_depth.fetch_add(queue_depth, std::memory_order_relaxed);
+    StoreMax(max_wait_ns, wait_ns);
+    StoreMax(max_depth, queue_depth);
+}
+
+void QueueStatistics::Clear() {
+    count.store(0, std::memory_order_relaxed);
+    total_wait_ns.store(0, std::memory_order_relaxed);
+    max_wait_ns.store(0, std::memory_order_relaxed);
+    total_depth.store(0, std::memory_order_relaxed);
+    max_depth.store(0, std::memory_order_relaxed);
+}
+
+ServiceStatistics::ServiceStatistics() = default;
+
+ServiceStatistics::~ServiceStatistics() = default;
+
+QueueStatistics& ServiceStatistics::GetQueue(const std::string& server_name) {
+    std::scoped_lock lk{mutex};
+    auto& queue = queues[server_name];
+    if (!queue) {
+        queue = std::make_unique<QueueStatistics>();
+    }
+    return *queue;
+}
+
+CommandStatistics& ServiceStatistics::GetCommand(const std::string& service_name, bool is_tipc,
+                                                 u32 command, const char* command_name) {
+    std::scoped_lock lk{mutex};
+    auto& entry = entries[Key{service_name, is_tipc, command}];
+    if (!entry) {
+        entry = std::make_unique<Entry>();
+        entry->command_name = command_name;
+    }
+    return entry->statistics;
+}
+
+void ServiceStatistics::Dump() const {
+    std::scoped_lock lk{mutex};
+
+    const auto to_us = [](std::chrono::nanoseconds ns) {
+        return static_cast<double>(ns.count()) / 1000.0;
+    };
+
+    std::vector<std::pair<const std::string*, const QueueStatistics*>> used_queues;
+    for (const auto& [server_name, queue] : queues) {
+        if (queue->GetCount() != 0) {
+            used_queues.emplace_back(&server_name, queue.get());
+        }
+    }
+    std::ranges::sort(used_queues, [](const auto& lhs, const auto& rhs) {
+        return lhs.second->GetTotalWait() > rhs.second->GetTotalWait();
+    });
+
+    LOG_INFO(Service, "Request queues of {} servers", used_queues.size());
+    for (const auto& [server_name, queue] : used_queues) {
+        const auto count = static_cast<double>(queue->GetCount());
+        LOG_INFO(Service,
+                 "{}: requests={}, mean wait={:.2f}us, max wait={:.2f}us, mean depth={:.2f}, "
+                 "max depth={}",
+                 *server_name, queue->GetCount(), to_us(queue->GetTotalWait()) / count,
+                 to_us(queue->GetMaxWait()), static_cast<double>(queue->GetTotalDepth()) / count,
+                 queue->GetMaxDepth());
+    }
+
+    std::vector<std::pair<const Key*, const Entry*>> called;
+    for (const auto& [key, entry] : entries) {
+        if (entry->statistics.GetCount() != 0) {
+            called.emplace_back(&key, entry.get());
+        }
+    }
+    std::ranges::sort(called, [](const auto& lhs, const auto& rhs) {
+        return lhs.second->statistics.GetTotal() > rhs.second->statistics.GetTotal();
+    });
+
+    LOG_INFO(Service, "Service statistics for {} commands", called.size());
+    for (const auto& [key, entry] : called) {
+        const auto& [service_name, is_tipc, command] = *key;
+        const CommandStatistics& statistics = entry->statistics;
+        LOG_INFO(Service,
+                 "{}{}::{} ({}): calls={}, total={:.1f}us, mean={:.2f}us, p50<={:.2f}us, "
+                 "p99<={:.2f}us, max={:.2f}us",
+                 service_name, is_tipc ? " (TIPC)" : "", entry->command_name, command,
+                 statistics.GetCount(), to_us(statistics.GetTotal()),
+                 to_us(statistics.GetTotal()) / static_cast<double>(statistics.GetCount()),
+                 to_us(statistics.GetPercentile(0.5)), to_us(statistics.GetPercentile(0.99)),
+                 to_us(statistics.GetMax()));
+    }
+}
+
+void ServiceStatistics::Clear() {
+    std::scoped_lock lk{mutex};
+    for (auto& [server_name, queue] : queues) {
+        queue->Clear();
+    }
+    for (auto& [key, entry] : entries) {
+        entry->statistics.Clear();
+    }
+}
+
+} // namespace Service
@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+#include "common/common_types.h"
+
+namespace Service {
+
+/// Number of calls and latency distribution of a single service command.
+class CommandStatistics {
+public:
+    /// Bucket i counts the calls that took [2^i, 2^(i+1)) ns, the last one every longer call.
+    static constexpr size_t NumBuckets = 32;
+
+    void Record(std::chrono::nanoseconds latency);
+    void Clear();
+
+    [[nodiscard]] u64 GetCount() const {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds GetTotal() const {
+        return std::chrono::nanoseconds{total_ns.load(std::memory_order_relaxed)};
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds GetMax() const {
+        return std::chrono::nanoseconds{max_ns.load(std::memory_order_relaxed)};
+    }
+
+    [[nodiscard]] u64 GetBucket(size_t index) const {
+        return buckets[index].load(std::memory_order_relaxed);
+    }
+
+    /// Returns an upper bound of the given percentile of the latency, in [0, 1].
+    [[nodiscard]] std::chrono::nanoseconds GetPercentile(double percentile) const;
+
+private:
+    std::atomic<u64> count{};
+    std::atomic<u64> total_ns{};
+    std::atomic<u64> max_ns{};
+    std::array<std::atomic<u64>, NumBuckets> buckets{};
+};
+
+/// Time the requests to a server waited before being handled, and how many queued behind them.
+class QueueStatistics {
+public:
+    void Record(std::chrono::nanoseconds wait_time, u32 queue_depth);
+    void Clear();
+
+    [[nodiscard]] u64 GetCount() const {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds GetTotalWait() const {
+        return std::chrono::nanoseconds{total_wait_ns.load(std::memory_order_relaxed)};
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds GetMaxWait() const {
+        return std::chrono::nanoseconds{max_wait_ns.load(std::memory_order_relaxed)};
+    }
+
+    [[nodiscard]] u64 GetTotalDepth() const {
+        return total_depth.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] u32 GetMaxDepth() const {
+        return max_depth.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<u64> count{};
+    std::atomic<u64> total_wait_ns{};
+    std::atomic<u64> max_wait_ns{};
+    std::atomic<u64> total_depth{};
+    std::atomic<u32> max_depth{};
+};
+
+/**
+ * Collects the statistics of every service command called while
+ * Settings::values.record_service_statistics is enabled. Commands are keyed by the name of their
+ * service, so that all the sessions and interfaces of a service add up.
+ */
+class ServiceStatistics {
+public:
+    ServiceStatistics();
+    ~ServiceStatistics();
+
+    /// Returns the statistics of a command. The reference stays valid until destruction.
+    [[nodiscard]] CommandStatistics& GetCommand(const std::string& service_name, bool is_tipc,
+                                                u32 command, const char* command_name);
+
+    /// Returns the queue statistics of a server. The reference stays valid until destruction.
+    [[nodiscard]] QueueStatistics& GetQueue(const std::string& server_name);
+
+    /// Writes the statistics of every server and called command to the log, most expensive first.
+    void Dump() const;
+
+    /// Resets the statistics of every server and command.
+    void Clear();
+
+private:
+    struct Entry {
+        std::string command_name;
+        CommandStatistics statistics;
+    };
+
+    using Key = std::tuple<std::string, bool, u32>;
+
+    mutable std::mutex mutex;
+    std::map<Key, std::unique_ptr<Entry>> entries;
+    std::map<std::string, std::unique_ptr<QueueStatistics>, std::less<>> queues;
+};
+
+} // namespace Service
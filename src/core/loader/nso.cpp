@@ -167,7 +167,7 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
     auto* patch = patches ? &patches->operator[](patch_index) : nullptr;
     if (patch && !load_into_process) {
         // Patch SVCs and MRS calls in the guest code
-        while (!patch->PatchText(program_image, code)) {
+        while (!patch->PatchText(program_image, code, nso_header.build_id)) {
             patch = &patches->emplace_back();
         }
     } else if (patch) {
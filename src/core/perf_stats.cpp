@@ -118,6 +118,21 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     return results;
 }
 
+std::size_t PerfStats::GetRecordedFrameCount() const {
+    std::scoped_lock lock{object_mutex};
+    return current_index;
+}
+
+std::vector<double> PerfStats::GetFrametimes(std::size_t first_frame) const {
+    std::scoped_lock lock{object_mutex};
+
+    if (first_frame >= current_index) {
+        return {};
+    }
+    return std::vector<double>(perf_history.begin() + first_frame,
+                               perf_history.begin() + current_index);
+}
+
 double PerfStats::GetLastFrameTimeScale() const {
     std::scoped_lock lock{object_mutex};
 
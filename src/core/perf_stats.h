@@ -8,6 +8,7 @@
 #include <chrono>
 #include <cstddef>
 #include <mutex>
+#include <vector>
 #include "common/common_types.h"
 
 namespace Core {
@@ -34,6 +35,9 @@ public:
 
     using Clock = std::chrono::steady_clock;
 
+    /// Maximum number of system frames stored in the performance history
+    static constexpr std::size_t MaxRecordedFrames = 216000;
+
     void BeginSystemFrame();
     void EndSystemFrame();
     void EndGameFrame();
@@ -51,6 +55,17 @@ public:
      */
     double GetLastFrameTimeScale() const;
 
+    /**
+     * Returns the number of system frames stored in the performance history.
+     */
+    std::size_t GetRecordedFrameCount() const;
+
+    /**
+     * Returns the frametimes, in milliseconds, of the system frames stored in the performance
+     * history starting at the given frame.
+     */
+    std::vector<double> GetFrametimes(std::size_t first_frame) const;
+
 private:
     mutable std::mutex object_mutex;
 
@@ -60,7 +75,7 @@ private:
     std::size_t current_index{0};
     /// Stores an hour of historical frametime data useful for processing and tracking performance
     /// regressions with code changes.
-    std::array<double, 216000> perf_history{};
+    std::array<double, MaxRecordedFrames> perf_history{};
 
     /// Point when the cumulative counters were reset
     Clock::time_point reset_point = Clock::now();
@@ -0,0 +1,248 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+
+#include <fmt/format.h>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/thread.h"
+#include "core/arm/debug.h"
+#include "core/core.h"
+#include "core/hardware_properties.h"
+#include "core/hle/kernel/k_process.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/physical_core.h"
+#include "core/memory.h"
+#include "core/tools/guest_profiler.h"
+
+namespace Tools {
+namespace {
+
+/// Returns the PC and the return addresses of the frame chain, leaf first.
+std::vector<u64> WalkFrames(Kernel::KProcess& process, const Kernel::Svc::ThreadContext& ctx) {
+    auto& memory = process.GetMemory();
+    const bool is_64 = process.Is64Bit();
+    std::vector<u64> frames{ctx.pc, ctx.lr};
+
+    // fp points to the frame record of the caller, followed by the return address of the frame.
+    u64 fp = ctx.fp;
+    while (frames.size() < GuestProfiler::MaxFrames && fp != 0 && fp % 4 == 0 &&
+           memory.IsValidVirtualAddressRange(fp, is_64 ? 16 : 8)) {
+        frames.push_back(is_64 ? memory.Read64(fp + 8) : memory.Read32(fp + 4));
+        fp = is_64 ? memory.Read64(fp) : memory.Read32(fp);
+    }
+    return frames;
+}
+
+std::string FrameName(const Core::BacktraceEntry& entry) {
+    std::string name = entry.name.empty() ? fmt::format("{}+{:#x}", entry.module, entry.offset)
+                                          : fmt::format("{}!{}", entry.module, entry.name);
+    // Semicolons separate the frames of collapsed stacks.
+    std::ranges::replace(name, ';', ':');
+    return name;
+}
+
+double Percent(u64 samples, u64 total_samples) {
+    return 100.0 * static_cast<double>(samples) / static_cast<double>(total_samples);
+}
+
+} // Anonymous namespace
+
+GuestProfiler::GuestProfiler(Core::System& system_) : system{system_} {}
+
+GuestProfiler::~GuestProfiler() {
+    Stop();
+}
+
+void GuestProfiler::Start() {
+    if (sampler.joinable()) {
+        return;
+    }
+    sampler = std::jthread([this](std::stop_token stop_token) { SampleLoop(stop_token); });
+}
+
+void GuestProfiler::Stop() {
+    if (!sampler.joinable()) {
+        return;
+    }
+    sampler.request_stop();
+    sampler.join();
+
+    for (size_t core = 0; core < Core::Hardware::NUM_CPU_CORES; core++) {
+        system.Kernel().PhysicalCore(core).CancelSample();
+    }
+}
+
+void GuestProfiler::SampleLoop(std::stop_token stop_token) {
+    Common::SetCurrentThreadName("GuestProfiler");
+    while (!stop_token.stop_requested()) {
+        for (size_t core = 0; core < Core::Hardware::NUM_CPU_CORES; core++) {
+            SampleCore(core);
+        }
+        std::this_thread::sleep_for(SampleInterval);
+    }
+}
+
+void GuestProfiler::SampleCore(size_t core_index) {
+    auto& kernel = system.Kernel();
+    auto& physical_core = kernel.PhysicalCore(core_index);
+
+    // Guest samples are recorded by the core itself, once it stops.
+    if (physical_core.RequestSample(*this)) {
+        return;
+    }
+
+    const auto svc = physical_core.GetCurrentSvc();
+    const bool is_idle = !svc && kernel.Scheduler(core_index).IsIdle();
+
+    std::scoped_lock lk{mutex};
+    if (svc) {
+        ++svc_samples[*svc];
+    } else if (is_idle) {
+        ++idle_samples;
+    } else {
+        ++host_samples;
+    }
+}
+
+void GuestProfiler::RecordGuestSample(Kernel::KProcess& process,
+                                      const Kernel::Svc::ThreadContext& ctx) {
+    auto frames = WalkFrames(process, ctx);
+
+    std::scoped_lock lk{mutex};
+    auto& samples = processes[process.GetProcessId()];
+    if (samples.name.empty()) {
+        samples.name = process.GetName();
+    }
+    ++samples.stacks[std::move(frames)];
+}
+
+bool GuestProfiler::Dump() {
+    // Symbolizing reads the symbol tables of every module, so work on a copy of the samples.
+    std::unordered_map<u64, ProcessSamples> process_samples;
+    std::map<u32, u64> svcs;
+    u64 host{};
+    u64 idle{};
+    {
+        std::scoped_lock lk{mutex};
+        process_samples = processes;
+        svcs = svc_samples;
+        host = host_samples;
+        idle = idle_samples;
+    }
+
+    auto process_list = system.Kernel().GetProcessList();
+    std::map<std::string, u64> module_samples;
+    std::string output;
+    u64 total_samples = host + idle;
+
+    for (const auto& [process_id, samples] : process_samples) {
+        auto it = std::ranges::find_if(process_list, [process_id](auto& process) {
+            return process->GetProcessId() == process_id;
+        });
+
+        std::vector<Core::BacktraceEntry> entries;
+        for (const auto& frames : samples.stacks | std::views::keys) {
+            for (const u64 address : frames) {
+                entries.push_back({"", 0, address, 0, ""});
+            }
+        }
+        std::ranges::sort(entries, {}, &Core::BacktraceEntry::original_address);
+        const auto [first, last] =
+            std::ranges::unique(entries, {}, &Core::BacktraceEntry::original_address);
+        entries.erase(first, last);
+        if (it != process_list.end()) {
+            Core::SymbolicateBacktrace(it->GetPointerUnsafe(), entries);
+        } else {
+            for (auto& entry : entries) {
+                entry.module = "unknown";
+                entry.offset = entry.original_address;
+            }
+        }
+
+        std::unordered_map<u64, std::pair<std::string, const std::string*>> names;
+        for (const auto& entry : entries) {
+            names.emplace(entry.original_address, std::pair{FrameName(entry), &entry.module});
+        }
+
+        for (const auto& [frames, count] : samples.stacks) {
+            total_samples += count;
+            module_samples[*names.at(frames.front()).second] += count;
+
+            // The link register repeats the current function until it calls another one, so
+            // consecutive samples of a function are merged.
+            fmt::format_to(std::back_inserter(output), "{}", samples.name);
+            const std::string* previous = nullptr;
+            for (const u64 address : frames | std::views::reverse) {
+                const std::string& name = names.at(address).first;
+                if (previous == nullptr || *previous != name) {
+                    fmt::format_to(std::back_inserter(output), ";{}", name);
+                }
+                previous = &name;
+            }
+            fmt::format_to(std::back_inserter(output), " {}\n", count);
+        }
+    }
+
+    for (const auto& [svc, count] : svcs) {
+        total_samples += count;
+        fmt::format_to(std::back_inserter(output), "[svc];{:#x} {}\n", svc, count);
+    }
+    if (host != 0) {
+        fmt::format_to(std::back_inserter(output), "[host] {}\n", host);
+    }
+
+    if (total_samples == 0) {
+        LOG_INFO(Core_ARM, "No guest profile samples were recorded");
+        return true;
+    }
+
+    const auto path = Common::FS::GetCitronPath(Common::FS::CitronPath::LogDir) /
+                      "guest_profile.folded";
+    void(Common::FS::CreateParentDirs(path));
+    if (Common::FS::WriteStringToFile(path, Common::FS::FileType::TextFile, output) !=
+        output.size()) {
+        LOG_ERROR(Core_ARM, "Failed to write the guest profile to {}",
+                  Common::FS::PathToUTF8String(path));
+        return false;
+    }
+
+    std::vector<std::pair<u64, std::string>> breakdown;
+    for (auto& [module, count] : module_samples) {
+        breakdown.emplace_back(count, module);
+    }
+    u64 total_svc_samples = 0;
+    for (const u64 count : svcs | std::views::values) {
+        total_svc_samples += count;
+    }
+    breakdown.emplace_back(total_svc_samples, "[svc]");
+    breakdown.emplace_back(host, "[host]");
+    breakdown.emplace_back(idle, "[idle]");
+    std::ranges::sort(breakdown, std::greater{});
+
+    LOG_INFO(Core_ARM, "Guest profile of {} samples written to {}", total_samples,
+             Common::FS::PathToUTF8String(path));
+    for (const auto& [count, name] : breakdown) {
+        if (count != 0) {
+            LOG_INFO(Core_ARM, "{}: {:.1f}% ({} samples)", name, Percent(count, total_samples),
+                     count);
+        }
+    }
+    return true;
+}
+
+void GuestProfiler::Clear() {
+    std::scoped_lock lk{mutex};
+    processes.clear();
+    svc_samples.clear();
+    host_samples = 0;
+    idle_samples = 0;
+}
+
+} // namespace Tools
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_types.h"
+
+namespace Core {
+class System;
+}
+
+namespace Kernel {
+class KProcess;
+}
+
+namespace Kernel::Svc {
+struct ThreadContext;
+}
+
+namespace Tools {
+
+/**
+ * Sampling profiler for the code running on the emulated CPU cores.
+ *
+ * A host thread samples every core at a fixed interval. Cores running guest code are halted for
+ * a moment, so that they record their PC and the return addresses of their frame chain. Cores
+ * performing a supervisor call, running HLE or kernel code on the host, or idling are only
+ * counted. Samples are symbolized when dumped, as collapsed stacks that flame graph tools accept.
+ */
+class GuestProfiler {
+public:
+    static constexpr std::chrono::microseconds SampleInterval{1000};
+    static constexpr size_t MaxFrames = 64;
+
+    explicit GuestProfiler(Core::System& system_);
+    ~GuestProfiler();
+
+    /// Starts sampling the cores.
+    void Start();
+
+    /// Stops sampling the cores, keeping the samples recorded so far.
+    void Stop();
+
+    /// Records a sample of the guest code of a process. Called by the sampled core.
+    void RecordGuestSample(Kernel::KProcess& process, const Kernel::Svc::ThreadContext& ctx);
+
+    /// Writes the samples as collapsed stacks to the log directory, and the share of each module
+    /// to the log. Processes that exited since they were sampled are written unsymbolized.
+    bool Dump();
+
+    /// Drops every recorded sample.
+    void Clear();
+
+private:
+    struct ProcessSamples {
+        std::string name;
+        std::map<std::vector<u64>, u64> stacks; ///< Sampled PC and return addresses, leaf first
+    };
+
+    void SampleLoop(std::stop_token stop_token);
+    void SampleCore(size_t core_index);
+
+    Core::System& system;
+    std::jthread sampler;
+
+    std::mutex mutex;
+    std::unordered_map<u64, ProcessSamples> processes; ///< Keyed by process ID
+    std::map<u32, u64> svc_samples;
+    u64 host_samples{};
+    u64 idle_samples{};
+};
+
+} // namespace Tools
@@ -128,8 +128,10 @@ inline bool RemoveMod(const Service::FileSystem::FileSystemController& fs_contro
  * \param vfs Reference to the VfsFilesystem instance in Core::System
  * \param filename Path to the NSP file
  * \param callback Callback to report the progress of the installation. The first size_t
- * parameter is the total size of the virtual file and the second is the current progress. If you
- * return true to the callback, it will cancel the installation as soon as possible.
+ * parameter is the total size of the virtual file and the second is the current progress. It is
+ * called once per FileSys::VFS_RC_LARGE_COPY_BLOCK copied, from several threads at once as the
+ * NCAs of the package are copied concurrently. If you return true to the callback, it will cancel
+ * the installation as soon as possible.
  * \return [InstallResult] representing how the installation finished
  */
 inline InstallResult InstallNSP(Core::System& system, FileSys::VfsFilesystem& vfs,
@@ -144,8 +146,7 @@ inline InstallResult InstallNSP(Core::System& system, FileSys::VfsFilesystem& vf
             return false;
         }
 
-        using namespace Common::Literals;
-        std::vector<u8> buffer(1_MiB);
+        std::vector<u8> buffer(block_size);
 
         for (std::size_t i = 0; i < src->GetSize(); i += buffer.size()) {
             if (callback(src->GetSize(), i)) {
@@ -210,8 +211,7 @@ inline InstallResult InstallNCA(FileSys::VfsFilesystem& vfs, const std::string&
             return false;
         }
 
-        using namespace Common::Literals;
-        std::vector<u8> buffer(1_MiB);
+        std::vector<u8> buffer(block_size);
 
         for (std::size_t i = 0; i < src->GetSize(); i += buffer.size()) {
             if (callback(src->GetSize(), i)) {
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+#include "common/common_types.h"
+#include "common/fixed_point.h"
+
+namespace {
+
+using namespace AudioCore::Renderer;
+
+std::vector<s32> RandomSamples(std::mt19937& rng, size_t count) {
+    std::uniform_int_distribution<s32> distribution{-(1 << 23), 1 << 23};
+    std::vector<s32> samples(count);
+    for (s32& sample : samples) {
+        sample = distribution(rng);
+    }
+    return samples;
+}
+
+/// Runs the loops the mix commands used before the kernels existed.
+template <size_t Q>
+std::vector<s32> Reference(std::vector<s32> output, const std::vector<s32>& input, f32 volume_,
+                           f32 ramp_, bool accumulate) {
+    Common::FixedPoint<64 - Q, Q> volume{volume_};
+    const Common::FixedPoint<64 - Q, Q> ramp{ramp_};
+    for (size_t i = 0; i < output.size(); i++) {
+        auto sample{input[i] * volume};
+        output[i] = accumulate ? (output[i] + sample).to_int() : sample.to_int();
+        volume += ramp;
+    }
+    return output;
+}
+
+template <size_t Q>
+void CheckKernels(std::mt19937& rng, f32 volume, f32 ramp, size_t count) {
+    const auto input{RandomSamples(rng, count)};
+    const auto initial_output{RandomSamples(rng, count)};
+    const s64 raw_volume{Common::FixedPoint<64 - Q, Q>{volume}.to_raw()};
+    const s64 raw_ramp{Common::FixedPoint<64 - Q, Q>{ramp}.to_raw()};
+
+    auto mixed{initial_output};
+    MixKernels::MixRamp(mixed, input, raw_volume, raw_ramp, Q);
+    REQUIRE(mixed == Reference<Q>(initial_output, input, volume, ramp, true));
+
+    auto scaled{initial_output};
+    MixKernels::ApplyGainRamp(scaled, input, raw_volume, raw_ramp, Q);
+    REQUIRE(scaled == Reference<Q>(initial_output, input, volume, ramp, false));
+}
+
+} // Anonymous namespace
+
+TEST_CASE("MixKernels::MatchFixedPoint", "[audio_core]") {
+    std::mt19937 rng{0x4D495853};
+    std::uniform_real_distribution<f32> volumes{-4.0f, 4.0f};
+    for (size_t iteration = 0; iteration < 2000; iteration++) {
+        // Cover every tail length of the vector loops and both constant and ramping volumes
+        const size_t count{iteration % 67 + (iteration % 3 == 0 ? 240 : 0)};
+        const f32 volume{volumes(rng)};
+        const f32 ramp{iteration % 2 == 0 ? 0.0f : volumes(rng) / 240.0f};
+        CheckKernels<15>(rng, volume, ramp, count);
+        CheckKernels<23>(rng, volume, ramp, count);
+    }
+}
+
+TEST_CASE("MixKernels::LargeVolume", "[audio_core]") {
+    // Volumes that do not fit in 32 bits take the scalar path
+    std::mt19937 rng{0x564F4C};
+    CheckKernels<23>(rng, 300.0f, 0.0f, 240);
+    CheckKernels<23>(rng, 200.0f, 1.0f, 240);
+}
+
+TEST_CASE("MixKernels::Benchmark", "[.][audio_core][benchmark]") {
+    constexpr size_t SampleCount = 240;
+    constexpr size_t VoiceCount = 128;
+    std::mt19937 rng{0x42454E43};
+    const auto input{RandomSamples(rng, SampleCount * VoiceCount)};
+    auto output{RandomSamples(rng, SampleCount)};
+    const s64 volume{Common::FixedPoint<49, 15>{0.75f}.to_raw()};
+    const s64 ramp{Common::FixedPoint<49, 15>{0.25f / SampleCount}.to_raw()};
+    const std::span<const s32> voices{input};
+
+    BENCHMARK("MixRamp") {
+        for (size_t voice = 0; voice < VoiceCount; voice++) {
+            MixKernels::MixRamp(output, voices.subspan(voice * SampleCount, SampleCount), volume,
+                                ramp, 15);
+        }
+        return output[0];
+    };
+
+    BENCHMARK("MixRampScalar") {
+        for (size_t voice = 0; voice < VoiceCount; voice++) {
+            MixKernels::MixRampScalar(output, voices.subspan(voice * SampleCount, SampleCount),
+                                      volume, ramp, 15);
+        }
+        return output[0];
+    };
+}
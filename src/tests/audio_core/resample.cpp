@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "audio_core/common/common.h"
+#include "audio_core/renderer/command/resample/resample.h"
+#include "common/common_types.h"
+#include "common/fixed_point.h"
+
+namespace {
+
+using AudioCore::SrcQuality;
+using AudioCore::Renderer::Resample;
+using AudioCore::Renderer::ResampleScalar;
+
+void CheckResample(std::mt19937& rng, SrcQuality quality, f32 ratio, u32 samples_to_write) {
+    std::uniform_int_distribution<s32> distribution{-32768, 32767};
+    // Large enough for the read position and every filter tap at the highest ratio
+    std::vector<s16> input(samples_to_write * 5 + 16);
+    for (s16& sample : input) {
+        sample = static_cast<s16>(distribution(rng));
+    }
+
+    const Common::FixedPoint<49, 15> sample_rate_ratio{ratio};
+    const auto start_fraction{Common::FixedPoint<49, 15>::from_base(rng() & 0x7FFF)};
+    auto fraction{start_fraction};
+    auto expected_fraction{start_fraction};
+
+    std::vector<s32> output(samples_to_write);
+    std::vector<s32> expected(samples_to_write);
+    Resample(output, input, sample_rate_ratio, fraction, samples_to_write, quality);
+    ResampleScalar(expected, input, sample_rate_ratio, expected_fraction, samples_to_write,
+                   quality);
+
+    REQUIRE(output == expected);
+    REQUIRE(fraction.to_raw() == expected_fraction.to_raw());
+}
+
+} // Anonymous namespace
+
+TEST_CASE("Resample::MatchScalar", "[audio_core]") {
+    std::mt19937 rng{0x52534D50};
+    for (u32 iteration = 0; iteration < 1000; iteration++) {
+        // Ratios cover every lookup table, and counts cover every tail of the batched path
+        const f32 ratio{0.25f + static_cast<f32>(rng() % 1000) / 250.0f};
+        const u32 samples_to_write{iteration % 37 + (iteration % 2 == 0 ? 240 : 0)};
+        CheckResample(rng, SrcQuality::Medium, ratio, samples_to_write);
+        CheckResample(rng, SrcQuality::High, ratio, samples_to_write);
+    }
+}
+
+TEST_CASE("Resample::UnityRatio", "[audio_core]") {
+    std::mt19937 rng{0x554E4954};
+    CheckResample(rng, SrcQuality::Medium, 1.0f, 240);
+    CheckResample(rng, SrcQuality::High, 1.0f, 240);
+}
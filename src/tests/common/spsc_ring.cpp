@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <thread>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/bounded_threadsafe_queue.h"
+#include "common/common_types.h"
+#include "common/polyfill_thread.h"
+#include "common/spsc_ring.h"
+
+namespace {
+
+constexpr u64 ItemCount = 1 << 16;
+
+/// Streams ItemCount values through the queue from a producer thread.
+template <typename Queue>
+u64 Stream(Queue& queue) {
+    std::jthread producer([&queue] {
+        for (u64 i = 1; i <= ItemCount; i++) {
+            queue.EmplaceWait(i);
+        }
+    });
+    std::stop_source stop_source;
+    u64 sum = 0;
+    u64 value;
+    for (u64 i = 0; i < ItemCount; i++) {
+        queue.PopWait(value, stop_source.get_token());
+        sum += value;
+    }
+    return sum;
+}
+
+/// Bounces a value between two threads through a pair of queues.
+template <typename Queue>
+void PingPong(Queue& ping, Queue& pong, u64 round_trips) {
+    std::jthread echo([&ping, &pong, round_trips] {
+        std::stop_source stop_source;
+        u64 value;
+        for (u64 i = 0; i < round_trips; i++) {
+            ping.PopWait(value, stop_source.get_token());
+            pong.EmplaceWait(value);
+        }
+    });
+    std::stop_source stop_source;
+    u64 value;
+    for (u64 i = 0; i < round_trips; i++) {
+        ping.EmplaceWait(i);
+        pong.PopWait(value, stop_source.get_token());
+    }
+}
+
+} // Anonymous namespace
+
+TEST_CASE("SPSCRing: Basic", "[common]") {
+    Common::SPSCRing<u64, 4> ring;
+    u64 value;
+    REQUIRE(!ring.TryPop(value));
+    for (u64 i = 0; i < 4; i++) {
+        REQUIRE(ring.TryEmplace(i));
+    }
+    REQUIRE(!ring.TryEmplace(u64{4}));
+    REQUIRE(ring.Size() == 4);
+    for (u64 i = 0; i < 4; i++) {
+        REQUIRE(ring.TryPop(value));
+        REQUIRE(value == i);
+    }
+    REQUIRE(ring.Size() == 0);
+    REQUIRE(!ring.TryPop(value));
+}
+
+TEST_CASE("SPSCRing: Threaded", "[common]") {
+    // A small ring makes both sides park repeatedly
+    Common::SPSCRing<u64, 8> ring;
+    REQUIRE(Stream(ring) == ItemCount * (ItemCount + 1) / 2);
+}
+
+TEST_CASE("SPSCRing: Stop wakes a parked consumer", "[common]") {
+    Common::SPSCRing<u64, 8> ring;
+    bool popped = true;
+    std::jthread consumer([&ring, &popped](std::stop_token stop_token) {
+        u64 value;
+        popped = ring.PopWait(value, stop_token);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    consumer.request_stop();
+    consumer.join();
+    REQUIRE(!popped);
+}
+
+TEST_CASE("SPSCRing: Benchmark", "[.][common][benchmark]") {
+    BENCHMARK("SPSCRing throughput") {
+        Common::SPSCRing<u64> ring;
+        return Stream(ring);
+    };
+    BENCHMARK("MPSCQueue throughput") {
+        Common::MPSCQueue<u64> queue;
+        return Stream(queue);
+    };
+    BENCHMARK("SPSCRing round trip") {
+        Common::SPSCRing<u64> ping;
+        Common::SPSCRing<u64> pong;
+        PingPong(ping, pong, 1024);
+    };
+    BENCHMARK("MPSCQueue round trip") {
+        Common::MPSCQueue<u64> ping;
+        Common::MPSCQueue<u64> pong;
+        PingPong(ping, pong, 1024);
+    };
+}
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: 2016 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
@@ -10,6 +11,8 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "core/core.h"
 #include "core/core_timing.h"
@@ -139,3 +142,91 @@ TEST_CASE("CoreTiming[BasicOrderNoPausing]", "[core]") {
     printf("HostTimer No Pausing Timer Time: %.3f %.6f\n", timer_time / 1000.f,
            timer_time / 1000000.f);
 }
+
+TEST_CASE("CoreTiming[UnscheduleAndReschedule]", "[core]") {
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    core_timing.SyncPause(true);
+
+    std::vector<size_t> fired;
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events;
+    for (size_t i = 0; i < 5; i++) {
+        events.push_back(Core::Timing::CreateEvent(
+            "callback", [&fired, i](s64, std::chrono::nanoseconds)
+                            -> std::optional<std::chrono::nanoseconds> {
+                fired.push_back(i);
+                return std::nullopt;
+            }));
+    }
+
+    // Times that have passed before Advance, so that it fires everything that is pending.
+    using std::chrono::nanoseconds;
+    const auto now = core_timing.GetGlobalTimeNs();
+    core_timing.ScheduleEvent(now + nanoseconds{40}, events[0], true);
+    core_timing.ScheduleEvent(now + nanoseconds{10}, events[1], true);
+    core_timing.ScheduleEvent(now + nanoseconds{30}, events[2], true);
+    core_timing.ScheduleEvent(now + nanoseconds{20}, events[1], true);
+    core_timing.ScheduleEvent(now + nanoseconds{30}, events[3], true);
+    core_timing.ScheduleLoopingEvent(now + nanoseconds{5}, std::chrono::hours{1}, events[4],
+                                     true);
+    core_timing.UnscheduleEvent(events[1]);
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+
+    // Events at the same time fire in the order they were scheduled, and the looping event
+    // is moved an hour ahead instead of firing again.
+    const std::vector<size_t> expected_order{4, 2, 3, 0};
+    const auto next_time = core_timing.Advance();
+    REQUIRE(fired == expected_order);
+    REQUIRE(next_time == (now + nanoseconds{5} + std::chrono::hours{1}).count());
+
+    core_timing.UnscheduleEvent(events[4]);
+    REQUIRE(!core_timing.Advance().has_value());
+}
+
+TEST_CASE("CoreTiming[Benchmark]", "[.][core][benchmark]") {
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    core_timing.SyncPause(true);
+
+    constexpr size_t NumEvents = 1024;
+    u64 num_fired = 0;
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events;
+    for (size_t i = 0; i < NumEvents; i++) {
+        events.push_back(Core::Timing::CreateEvent(
+            "benchmark",
+            [&num_fired](s64, std::chrono::nanoseconds) -> std::optional<std::chrono::nanoseconds> {
+                ++num_fired;
+                return std::nullopt;
+            }));
+    }
+
+    const auto future_ns = [](size_t i) {
+        return std::chrono::nanoseconds{static_cast<s64>((i * 7919) % NumEvents) * 1000 +
+                                        1'000'000'000};
+    };
+
+    BENCHMARK("Schedule and unschedule 1024 events") {
+        for (size_t i = 0; i < NumEvents; i++) {
+            core_timing.ScheduleEvent(future_ns(i), events[i]);
+        }
+        for (size_t i = 0; i < NumEvents; i++) {
+            core_timing.UnscheduleEvent(events[i], Core::Timing::UnscheduleEventType::NoWait);
+        }
+        return core_timing.HasPendingEvents();
+    };
+
+    BENCHMARK("Fire and reschedule 1024 looping events") {
+        const auto now = core_timing.GetGlobalTimeNs();
+        for (size_t i = 0; i < NumEvents; i++) {
+            core_timing.ScheduleLoopingEvent(now - std::chrono::nanoseconds{static_cast<s64>(i)},
+                                             future_ns(i), events[i], true);
+        }
+        const auto next_time = core_timing.Advance();
+        for (size_t i = 0; i < NumEvents; i++) {
+            core_timing.UnscheduleEvent(events[i], Core::Timing::UnscheduleEventType::NoWait);
+        }
+        return next_time;
+    };
+
+    REQUIRE(num_fired != 0);
+}
@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/hex_util.h"
+#include "core/crypto/aes_hw.h"
+#include "core/crypto/aes_util.h"
+#include "core/crypto/key_manager.h"
+
+namespace {
+
+using namespace Core::Crypto;
+
+// NIST SP 800-38A vectors
+constexpr Key128 Sp800Key = Common::HexStringToArray<16>("2b7e151628aed2a6abf7158809cf4f3c");
+const std::vector<u8> Sp800Plaintext =
+    Common::HexStringToVector("6bc1bee22e409f96e93d7e117393172aae2d8a571e03ac9c9eb76fac45af8e51"
+                              "30c81c46a35ce411e5fbc1191a0a52eff69f2445df4f9b17ad2b417be66c3710",
+                              false);
+
+std::vector<u8> Pattern(size_t size) {
+    std::vector<u8> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<u8>(i * 7 + (i >> 8));
+    }
+    return data;
+}
+
+void IncrementCounter(std::array<u8, 16>& counter) {
+    for (size_t i = counter.size(); i-- > 0;) {
+        if (++counter[i] != 0) {
+            break;
+        }
+    }
+}
+
+} // Anonymous namespace
+
+TEST_CASE("AESCipher: CTR", "[core]") {
+    const auto counter = Common::HexStringToArray<16>("f0f1f2f3f4f5f6f7f8f9fafbfcfdfeff");
+    const auto expected = Common::HexStringToVector("874d6191b620e3261bef6864990db6ce"
+                                                    "9806f66b7970fdff8617187bb9fffdff"
+                                                    "5ae4df3edbd5d35e5b4f09020db03eab"
+                                                    "1e031dda2fbe03d1792170a0f3009cee",
+                                                    false);
+    AESCipher<Key128> cipher(Sp800Key, Mode::CTR);
+    std::vector<u8> output(Sp800Plaintext.size());
+
+    cipher.SetIV(counter);
+    cipher.Transcode(Sp800Plaintext.data(), output.size(), output.data(), Op::Encrypt);
+    REQUIRE(output == expected);
+
+    // Every call advances the counter by the blocks it used, including partial ones
+    cipher.SetIV(counter);
+    cipher.Transcode(expected.data(), 20, output.data(), Op::Decrypt);
+    cipher.Transcode(expected.data() + 32, 32, output.data() + 32, Op::Decrypt);
+    REQUIRE(std::equal(output.begin(), output.begin() + 20, Sp800Plaintext.begin()));
+    REQUIRE(std::equal(output.begin() + 32, output.end(), Sp800Plaintext.begin() + 32));
+}
+
+TEST_CASE("AESCipher: CTR counter carry", "[core]") {
+    // The low half of the counter overflows into the high half
+    const auto counter = Common::HexStringToArray<16>("00000000000000fefffffffffffffffd");
+    const auto data = Pattern(0x1000 + 5);
+    AESCipher<Key128> ctr(Sp800Key, Mode::CTR);
+    std::vector<u8> output(data.size());
+    ctr.SetIV(counter);
+    ctr.Transcode(data.data(), data.size(), output.data(), Op::Encrypt);
+
+    AESCipher<Key128> ecb(Sp800Key, Mode::ECB);
+    std::array<u8, 16> block = counter;
+    for (size_t offset = 0; offset < data.size(); offset += block.size()) {
+        std::array<u8, 16> keystream;
+        ecb.Transcode(block.data(), block.size(), keystream.data(), Op::Encrypt);
+        for (size_t i = offset; i < std::min(offset + block.size(), data.size()); i++) {
+            REQUIRE(output[i] == (data[i] ^ keystream[i - offset]));
+        }
+        IncrementCounter(block);
+    }
+}
+
+TEST_CASE("AESCipher: ECB", "[core]") {
+    const auto expected = Common::HexStringToArray<16>("3ad77bb40d7a3660a89ecaf32466ef97");
+    AESCipher<Key128> cipher(Sp800Key, Mode::ECB);
+
+    std::vector<u8> output(Sp800Plaintext.size());
+    cipher.Transcode(Sp800Plaintext.data(), output.size(), output.data(), Op::Encrypt);
+    REQUIRE(std::equal(expected.begin(), expected.end(), output.begin()));
+
+    std::vector<u8> decrypted(output.size());
+    cipher.Transcode(output.data(), output.size(), decrypted.data(), Op::Decrypt);
+    REQUIRE(decrypted == Sp800Plaintext);
+
+    // A short block is zero padded and truncated
+    std::array<u8, 16> padded{};
+    std::copy_n(Sp800Plaintext.begin(), 5, padded.begin());
+    std::array<u8, 16> padded_output;
+    cipher.Transcode(padded.data(), padded.size(), padded_output.data(), Op::Encrypt);
+    std::array<u8, 5> short_output;
+    cipher.Transcode(Sp800Plaintext.data(), short_output.size(), short_output.data(),
+                     Op::Encrypt);
+    REQUIRE(std::equal(short_output.begin(), short_output.end(), padded_output.begin()));
+}
+
+TEST_CASE("AESCipher: XTS", "[core]") {
+    // IEEE 1619 vector 1
+    const auto expected = Common::HexStringToVector("917cf69ebd68b2ec9b9fe9a3eadda692"
+                                                    "cd43d2f59598ed858c02c2652fbf922e",
+                                                    false);
+    AESCipher<Key256> cipher(Key256{}, Mode::XTS);
+    const std::vector<u8> zeros(32);
+    std::vector<u8> output(zeros.size());
+    cipher.SetIV(std::array<u8, 16>{});
+    cipher.Transcode(zeros.data(), zeros.size(), output.data(), Op::Encrypt);
+    REQUIRE(output == expected);
+
+    // Sectors use big endian tweaks, and round trip
+    Key256 key;
+    std::copy_n(Pattern(key.size()).begin(), key.size(), key.begin());
+    AESCipher<Key256> sector_cipher(key, Mode::XTS);
+    const auto data = Pattern(0x4000 * 3);
+    std::vector<u8> encrypted(data.size());
+    std::vector<u8> decrypted(data.size());
+    sector_cipher.XTSTranscode(data.data(), data.size(), encrypted.data(), 5, 0x4000, Op::Encrypt);
+    sector_cipher.XTSTranscode(encrypted.data(), encrypted.size(), decrypted.data(), 5, 0x4000,
+                               Op::Decrypt);
+    REQUIRE(decrypted == data);
+
+    std::vector<u8> sector(0x4000);
+    std::array<u8, 16> tweak{};
+    tweak[15] = 6;
+    sector_cipher.SetIV(tweak);
+    sector_cipher.Transcode(data.data() + 0x4000, sector.size(), sector.data(), Op::Encrypt);
+    REQUIRE(std::equal(sector.begin(), sector.end(), encrypted.begin() + 0x4000));
+}
+
+TEST_CASE("AESCipher: Benchmark", "[.][core][benchmark]") {
+    auto data = Pattern(1 << 20);
+    AESCipher<Key128> ctr(Sp800Key, Mode::CTR);
+    AESCipher<Key256> xts(Key256{}, Mode::XTS);
+
+    BENCHMARK("CTR 1 MiB") {
+        ctr.SetIV(std::array<u8, 16>{});
+        ctr.Transcode(data.data(), data.size(), data.data(), Op::Decrypt);
+        return data[0];
+    };
+    BENCHMARK("XTS 1 MiB") {
+        xts.XTSTranscode(data.data(), data.size(), data.data(), 0, 0x4000, Op::Decrypt);
+        return data[0];
+    };
+    if (AESHW::IsSupported()) {
+        BENCHMARK("Hardware key expansion") {
+            AESHW::KeySchedule schedule;
+            AESHW::ExpandKey(schedule, Sp800Key.data());
+            return schedule.decrypt[5][0];
+        };
+    }
+}
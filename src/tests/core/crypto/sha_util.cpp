@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/hex_util.h"
+#include "core/crypto/sha_util.h"
+
+namespace {
+
+using Core::Crypto::SHA256Hash;
+using Core::Crypto::SHA256Hasher;
+
+SHA256Hash HashString(std::string_view string) {
+    return SHA256Hasher::Hash({reinterpret_cast<const u8*>(string.data()), string.size()});
+}
+
+SHA256Hash Expected(std::string_view hex) {
+    return Common::HexStringToArray<0x20>(hex);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("SHA256Hasher: Known answers", "[core]") {
+    // FIPS 180-2 vectors
+    REQUIRE(HashString("") ==
+            Expected("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"));
+    REQUIRE(HashString("abc") ==
+            Expected("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"));
+    REQUIRE(HashString("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+            Expected("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"));
+
+    const std::vector<u8> million_a(1000000, 'a');
+    REQUIRE(SHA256Hasher::Hash(million_a) ==
+            Expected("cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0"));
+}
+
+TEST_CASE("SHA256Hasher: Incremental updates", "[core]") {
+    std::vector<u8> data(1000);
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = static_cast<u8>(i * 31 + (i >> 7));
+    }
+
+    // Sizes around the padding boundary, split at every block offset
+    for (const size_t size : {55, 56, 63, 64, 65, 119, 120, 1000}) {
+        const std::span<const u8> input{data.data(), size};
+        const SHA256Hash expected = SHA256Hasher::Hash(input);
+        for (size_t split = 0; split <= std::min<size_t>(size, SHA256Hasher::BlockSize); split++) {
+            SHA256Hasher hasher;
+            hasher.Update(input.first(split));
+            hasher.Update(input.subspan(split));
+            REQUIRE(hasher.Finalize() == expected);
+        }
+    }
+
+    // Finalize resets the hasher
+    SHA256Hasher hasher;
+    hasher.Update(data);
+    (void)hasher.Finalize();
+    REQUIRE(hasher.Finalize() == HashString(""));
+}
+
+TEST_CASE("SHA256Hasher: Benchmark", "[.][core][benchmark]") {
+    const std::vector<u8> data(16 << 20);
+    BENCHMARK("Hash 16 MiB") {
+        return SHA256Hasher::Hash(data)[0];
+    };
+}
@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "core/file_sys/fssystem/fssystem_aes_ctr_storage.h"
+#include "core/file_sys/fssystem/fssystem_block_cache_storage.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+
+namespace {
+
+using FileSys::BlockCache;
+using FileSys::BlockCacheStorage;
+
+constexpr size_t BlockSize = BlockCache::BlockSize;
+
+/// Storage over a pattern that counts the reads reaching it.
+class CountingStorage : public FileSys::IReadOnlyStorage {
+public:
+    explicit CountingStorage(size_t size) : data(size) {
+        for (size_t i = 0; i < size; i++) {
+            data[i] = static_cast<u8>((i * 13) ^ (i >> 9));
+        }
+    }
+
+    size_t GetSize() const override {
+        return data.size();
+    }
+
+    size_t Read(u8* buffer, size_t size, size_t offset) const override {
+        ++reads;
+        if (offset >= data.size()) {
+            return 0;
+        }
+        size = std::min(size, data.size() - offset);
+        std::memcpy(buffer, data.data() + offset, size);
+        return size;
+    }
+
+    std::vector<u8> data;
+    mutable size_t reads{};
+};
+
+bool ReadMatches(const BlockCacheStorage& storage, const CountingStorage& base, size_t size,
+                 size_t offset) {
+    std::vector<u8> buffer(size);
+    if (offset >= base.data.size()) {
+        return storage.Read(buffer.data(), size, offset) == 0;
+    }
+    const size_t expected_size = std::min(size, base.data.size() - offset);
+    if (storage.Read(buffer.data(), size, offset) != expected_size) {
+        return false;
+    }
+    return std::equal(buffer.begin(), buffer.begin() + expected_size, base.data.begin() + offset);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("BlockCacheStorage: Hits and misses", "[core]") {
+    const auto cache = std::make_shared<BlockCache>(64 * BlockSize);
+    const auto base = std::make_shared<CountingStorage>(32 * BlockSize + 100);
+    const BlockCacheStorage storage(base, cache);
+    REQUIRE(storage.GetSize() == base->data.size());
+
+    // A random read does not read ahead
+    REQUIRE(ReadMatches(storage, *base, 100, 10 * BlockSize + 50));
+    REQUIRE(base->reads == 1);
+    REQUIRE(cache->GetCounters().misses == 1);
+    REQUIRE(cache->GetCounters().read_ahead_blocks == 0);
+    REQUIRE(cache->GetUsedSize() == BlockSize);
+
+    // Reading it again is served from the cache
+    REQUIRE(ReadMatches(storage, *base, 200, 10 * BlockSize));
+    REQUIRE(base->reads == 1);
+    REQUIRE(cache->GetCounters().hits == 1);
+
+    // A read spanning cached and missing blocks only reads the missing ones
+    REQUIRE(ReadMatches(storage, *base, 3 * BlockSize, 9 * BlockSize + 10));
+    REQUIRE(base->reads == 3);
+    REQUIRE(cache->GetCounters().misses == 4);
+
+    // The partial last block is cached too
+    REQUIRE(ReadMatches(storage, *base, BlockSize, 32 * BlockSize));
+    REQUIRE(ReadMatches(storage, *base, 10, 32 * BlockSize + 90));
+    REQUIRE(ReadMatches(storage, *base, 10, 40 * BlockSize));
+}
+
+TEST_CASE("BlockCacheStorage: Sequential read ahead", "[core]") {
+    const auto cache = std::make_shared<BlockCache>(64 * BlockSize);
+    const auto base = std::make_shared<CountingStorage>(48 * BlockSize);
+    const BlockCacheStorage storage(base, cache);
+
+    for (size_t offset = 0; offset < base->data.size(); offset += 4096) {
+        REQUIRE(ReadMatches(storage, *base, 4096, offset));
+    }
+    // The window grows to MaxReadAheadBlocks, so few reads reach the base storage
+    REQUIRE(base->reads < 8);
+    const auto counters = cache->GetCounters();
+    REQUIRE(counters.misses + counters.read_ahead_blocks == 48);
+    REQUIRE(counters.read_ahead_hits == counters.read_ahead_blocks);
+}
+
+TEST_CASE("BlockCacheStorage: Memory budget", "[core]") {
+    const auto cache = std::make_shared<BlockCache>(4 * BlockSize);
+    const auto base = std::make_shared<CountingStorage>(16 * BlockSize);
+    {
+        const BlockCacheStorage storage(base, cache);
+        for (size_t block : {1, 5, 9, 13, 3, 7}) {
+            REQUIRE(ReadMatches(storage, *base, 10, block * BlockSize));
+        }
+        REQUIRE(cache->GetUsedSize() == 4 * BlockSize);
+        REQUIRE(cache->GetCounters().evictions == 2);
+
+        // Least recently used blocks are evicted first
+        const size_t reads = base->reads;
+        REQUIRE(ReadMatches(storage, *base, 10, 9 * BlockSize));
+        REQUIRE(base->reads == reads);
+        REQUIRE(ReadMatches(storage, *base, 10, 1 * BlockSize));
+        REQUIRE(base->reads == reads + 1);
+
+        cache->SetCapacity(2 * BlockSize);
+        REQUIRE(cache->GetUsedSize() == 2 * BlockSize);
+    }
+    // Destroyed storages release their blocks
+    REQUIRE(cache->GetUsedSize() == 0);
+}
+
+TEST_CASE("BlockCacheStorage: Large reads bypass the cache", "[core]") {
+    const auto cache = std::make_shared<BlockCache>(64 * BlockSize);
+    const auto base = std::make_shared<CountingStorage>(64 * BlockSize);
+    const BlockCacheStorage storage(base, cache);
+    REQUIRE(ReadMatches(storage, *base, BlockCacheStorage::BypassSize, 3));
+    REQUIRE(base->reads == 1);
+    REQUIRE(cache->GetUsedSize() == 0);
+}
+
+TEST_CASE("BlockCacheStorage: Benchmark", "[.][core][benchmark]") {
+    // Hot reads over a 4 MiB region of an encrypted storage
+    const std::array<u8, FileSys::AesCtrStorage::KeySize> key{};
+    const std::array<u8, FileSys::AesCtrStorage::IvSize> iv{};
+    const auto encrypted = std::make_shared<FileSys::VectorVfsFile>(std::vector<u8>(32 << 20));
+    const auto base = std::make_shared<FileSys::AesCtrStorage>(encrypted, key.data(), key.size(),
+                                                               iv.data(), iv.size());
+    std::vector<size_t> offsets(4096);
+    std::mt19937 rng{0x424C4B43};
+    std::uniform_int_distribution<size_t> distribution{0, (4 << 20) - 4096};
+    for (size_t& offset : offsets) {
+        offset = distribution(rng) & ~size_t{FileSys::AesCtrStorage::BlockSize - 1};
+    }
+    std::vector<u8> buffer(4096);
+
+    BENCHMARK("AesCtrStorage") {
+        for (const size_t offset : offsets) {
+            base->Read(buffer.data(), buffer.size(), offset);
+        }
+        return buffer[0];
+    };
+    BENCHMARK("BlockCacheStorage") {
+        const BlockCacheStorage storage(base, std::make_shared<BlockCache>(64 << 20));
+        for (const size_t offset : offsets) {
+            storage.Read(buffer.data(), buffer.size(), offset);
+        }
+        return buffer[0];
+    };
+}
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/literals.h"
+#include "core/crypto/sha_util.h"
+#include "core/file_sys/fssystem/fssystem_integrity_verification_storage.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+
+namespace {
+
+using namespace Common::Literals;
+using FileSys::IntegrityVerificationStorage;
+
+constexpr size_t BlockSize = 16_KiB;
+
+std::vector<u8> Pattern(size_t size) {
+    std::vector<u8> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<u8>((i * 11) ^ (i >> 10));
+    }
+    return data;
+}
+
+/// Returns the hash of every block of data, with the last block zero padded.
+std::vector<u8> HashBlocks(const std::vector<u8>& data) {
+    std::vector<u8> hashes;
+    std::vector<u8> block(BlockSize);
+    for (size_t offset = 0; offset < data.size(); offset += BlockSize) {
+        const size_t size = std::min(BlockSize, data.size() - offset);
+        std::fill(std::copy_n(data.begin() + offset, size, block.begin()), block.end(), u8{0});
+        const auto hash = Core::Crypto::SHA256Hasher::Hash(block);
+        hashes.insert(hashes.end(), hash.begin(), hash.end());
+    }
+    return hashes;
+}
+
+std::shared_ptr<IntegrityVerificationStorage> MakeStorage(std::vector<u8> data,
+                                                          std::vector<u8> hashes) {
+    auto storage = std::make_shared<IntegrityVerificationStorage>();
+    storage->Initialize(std::make_shared<FileSys::VectorVfsFile>(std::move(hashes)),
+                        std::make_shared<FileSys::VectorVfsFile>(std::move(data)), BlockSize,
+                        BlockSize, true, true);
+    return storage;
+}
+
+bool ReadMatches(const IntegrityVerificationStorage& storage, const std::vector<u8>& data,
+                 size_t size, size_t offset) {
+    std::vector<u8> buffer(size);
+    const size_t expected_size = std::min(size, data.size() - offset);
+    return storage.Read(buffer.data(), size, offset) == expected_size &&
+           std::equal(buffer.begin(), buffer.begin() + expected_size, data.begin() + offset);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("IntegrityVerificationStorage: Valid blocks", "[core]") {
+    const auto data = Pattern(40 * BlockSize + 1000);
+    const auto storage = MakeStorage(data, HashBlocks(data));
+
+    // Unaligned reads, including the partial last block
+    REQUIRE(ReadMatches(*storage, data, 100, 3 * BlockSize + 5));
+    REQUIRE(ReadMatches(*storage, data, 2 * BlockSize, BlockSize / 2));
+    REQUIRE(ReadMatches(*storage, data, 900, 40 * BlockSize + 50));
+
+    // A large aligned read is hashed in parallel
+    REQUIRE(ReadMatches(*storage, data, 32 * BlockSize, 4 * BlockSize));
+    REQUIRE(storage->GetVerificationFailureCount() == 0);
+}
+
+TEST_CASE("IntegrityVerificationStorage: Corrupted blocks", "[core]") {
+    auto data = Pattern(24 * BlockSize);
+    const auto hashes = HashBlocks(data);
+    data[5 * BlockSize + 123] ^= 1;
+    data[17 * BlockSize] ^= 0x80;
+    const auto storage = MakeStorage(data, hashes);
+
+    REQUIRE(ReadMatches(*storage, data, 10, 5 * BlockSize + 100));
+    REQUIRE(storage->GetVerificationFailureCount() == 1);
+
+    // Each block is verified once per session
+    REQUIRE(ReadMatches(*storage, data, 10, 5 * BlockSize));
+    REQUIRE(storage->GetVerificationFailureCount() == 1);
+
+    REQUIRE(ReadMatches(*storage, data, data.size(), 0));
+    REQUIRE(storage->GetVerificationFailureCount() == 2);
+}
+
+TEST_CASE("IntegrityVerificationStorage: Benchmark", "[.][core][benchmark]") {
+    const auto data = Pattern(64 << 20);
+    const auto hashes = HashBlocks(data);
+    std::vector<u8> buffer(4 << 20);
+
+    BENCHMARK("First read of 64 MiB") {
+        const auto storage = MakeStorage(data, hashes);
+        for (size_t offset = 0; offset < data.size(); offset += buffer.size()) {
+            storage->Read(buffer.data(), buffer.size(), offset);
+        }
+        return buffer[0];
+    };
+}
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "core/file_sys/vfs/vfs_offset.h"
+#include "core/file_sys/vfs/vfs_real.h"
+
+namespace {
+
+using FileSys::OpenMode;
+
+/// Temporary file filled with a known pattern, removed when destroyed.
+class TestFile {
+public:
+    explicit TestFile(size_t size) : data(size) {
+        for (size_t i = 0; i < size; i++) {
+            data[i] = static_cast<u8>((i * 31) ^ (i >> 11));
+        }
+        path = std::filesystem::temp_directory_path() /
+               ("citron_vfs_real_" + std::to_string(size) + ".bin");
+        Common::FS::IOFile file(path, Common::FS::FileAccessMode::Write,
+                                Common::FS::FileType::BinaryFile);
+        written = file.WriteSpan(std::span<const u8>(data)) == size;
+    }
+
+    ~TestFile() {
+        Common::FS::RemoveFile(path);
+    }
+
+    [[nodiscard]] std::string Path() const {
+        return Common::FS::PathToUTF8String(path);
+    }
+
+    std::vector<u8> data;
+    std::filesystem::path path;
+    bool written{};
+};
+
+size_t ReadInChunks(const FileSys::VfsFile& file, std::vector<u8>& buffer) {
+    size_t total = 0;
+    for (size_t offset = 0; offset < file.GetSize(); offset += buffer.size()) {
+        total += file.Read(buffer.data(), buffer.size(), offset);
+    }
+    return total;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("RealVfsFile: Mapped reads", "[core]") {
+    const TestFile test_file(4 << 20);
+    REQUIRE(test_file.written);
+    FileSys::RealVfsFilesystem filesystem;
+    const auto file = filesystem.OpenFile(test_file.Path(), OpenMode::Read);
+    REQUIRE(file != nullptr);
+
+    const std::span<const u8> mapped = file->GetMappedData();
+    REQUIRE(mapped.size() == test_file.data.size());
+    REQUIRE(std::ranges::equal(mapped, test_file.data));
+
+    std::vector<u8> buffer(1000);
+    REQUIRE(file->Read(buffer.data(), buffer.size(), 12345) == buffer.size());
+    REQUIRE(std::equal(buffer.begin(), buffer.end(), test_file.data.begin() + 12345));
+
+    // Reads past the end are truncated
+    REQUIRE(file->Read(buffer.data(), buffer.size(), test_file.data.size() - 10) == 10);
+    REQUIRE(file->Read(buffer.data(), buffer.size(), test_file.data.size() + 10) == 0);
+
+    const FileSys::OffsetVfsFile offset_file(file, 4096, 1 << 20);
+    const std::span<const u8> offset_mapped = offset_file.GetMappedData();
+    REQUIRE(offset_mapped.size() == 4096);
+    REQUIRE(offset_mapped.data() == mapped.data() + (1 << 20));
+}
+
+TEST_CASE("RealVfsFile: Unmapped files", "[core]") {
+    const TestFile small_file(4096);
+    const TestFile large_file(2 << 20);
+    REQUIRE(small_file.written);
+    REQUIRE(large_file.written);
+    FileSys::RealVfsFilesystem filesystem;
+
+    // Small files are read with syscalls
+    const auto small = filesystem.OpenFile(small_file.Path(), OpenMode::Read);
+    REQUIRE(small != nullptr);
+    REQUIRE(small->GetMappedData().empty());
+    REQUIRE(small->ReadAllBytes() == small_file.data);
+
+    // Writable files are never mapped
+    const auto writable = filesystem.OpenFile(large_file.Path(), OpenMode::ReadWrite);
+    REQUIRE(writable != nullptr);
+    REQUIRE(writable->GetMappedData().empty());
+    REQUIRE(writable->ReadAllBytes() == large_file.data);
+}
+
+TEST_CASE("RealVfsFile: Benchmark", "[.][core][benchmark]") {
+    const TestFile test_file(64 << 20);
+    std::vector<u8> buffer(64 << 10);
+
+    BENCHMARK("IOFile") {
+        Common::FS::IOFile file(test_file.path, Common::FS::FileAccessMode::Read,
+                                Common::FS::FileType::BinaryFile);
+        size_t total = 0;
+        while (const size_t read = file.ReadSpan(std::span(buffer))) {
+            total += read;
+        }
+        return total;
+    };
+    BENCHMARK("RealVfsFile unmapped") {
+        FileSys::RealVfsFilesystem filesystem;
+        const auto file = filesystem.OpenFile(test_file.Path(), OpenMode::ReadWrite);
+        return ReadInChunks(*file, buffer);
+    };
+    BENCHMARK("RealVfsFile mapped") {
+        FileSys::RealVfsFilesystem filesystem;
+        const auto file = filesystem.OpenFile(test_file.Path(), OpenMode::Read);
+        return ReadInChunks(*file, buffer);
+    };
+}
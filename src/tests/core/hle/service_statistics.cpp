@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/hle/service/service_statistics.h"
+
+using std::chrono::nanoseconds;
+
+TEST_CASE("CommandStatistics: Histogram", "[core]") {
+    Service::CommandStatistics statistics;
+    REQUIRE(statistics.GetPercentile(0.5) == nanoseconds{0});
+
+    for (int i = 0; i < 98; i++) {
+        statistics.Record(nanoseconds{1500});
+    }
+    statistics.Record(nanoseconds{100'000});
+    statistics.Record(nanoseconds{3'000'000'000});
+
+    REQUIRE(statistics.GetCount() == 100);
+    REQUIRE(statistics.GetTotal() == nanoseconds{98 * 1500 + 100'000 + 3'000'000'000});
+    REQUIRE(statistics.GetMax() == nanoseconds{3'000'000'000});
+    REQUIRE(statistics.GetBucket(10) == 98);
+    REQUIRE(statistics.GetBucket(16) == 1);
+    REQUIRE(statistics.GetBucket(Service::CommandStatistics::NumBuckets - 1) == 1);
+
+    // Percentiles are reported as the upper bound of their bucket
+    REQUIRE(statistics.GetPercentile(0.5) == nanoseconds{2048});
+    REQUIRE(statistics.GetPercentile(0.99) == nanoseconds{131072});
+    REQUIRE(statistics.GetPercentile(1.0) == nanoseconds{3'000'000'000});
+
+    statistics.Clear();
+    REQUIRE(statistics.GetCount() == 0);
+    REQUIRE(statistics.GetBucket(10) == 0);
+}
+
+TEST_CASE("ServiceStatistics: Commands are shared by name", "[core]") {
+    Service::ServiceStatistics statistics;
+    auto& command = statistics.GetCommand("hid", false, 1, "CreateAppletResource");
+    REQUIRE(&statistics.GetCommand("hid", false, 1, "CreateAppletResource") == &command);
+    REQUIRE(&statistics.GetCommand("hid", true, 1, "CreateAppletResource") != &command);
+    REQUIRE(&statistics.GetCommand("hid", false, 2, "Other") != &command);
+
+    command.Record(nanoseconds{10});
+    statistics.Clear();
+    REQUIRE(command.GetCount() == 0);
+}
+
+TEST_CASE("QueueStatistics: Wait time and depth", "[core]") {
+    Service::QueueStatistics statistics;
+    statistics.Record(nanoseconds{1000}, 0);
+    statistics.Record(nanoseconds{5000}, 3);
+    statistics.Record(nanoseconds{-10}, 1);
+
+    REQUIRE(statistics.GetCount() == 3);
+    REQUIRE(statistics.GetTotalWait() == nanoseconds{6000});
+    REQUIRE(statistics.GetMaxWait() == nanoseconds{5000});
+    REQUIRE(statistics.GetTotalDepth() == 4);
+    REQUIRE(statistics.GetMaxDepth() == 3);
+
+    statistics.Clear();
+    REQUIRE(statistics.GetCount() == 0);
+    REQUIRE(statistics.GetMaxDepth() == 0);
+}
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/download_predictor.h"
+
+namespace {
+using VideoCommon::DownloadPredictor;
+using VideoCore::RasterizerDownloadArea;
+
+constexpr u64 PAGE = 4096;
+
+RasterizerDownloadArea Area(DAddr start, DAddr end) {
+    return RasterizerDownloadArea{
+        .start_address = start,
+        .end_address = end,
+        .preemtive = false,
+    };
+}
+} // Anonymous namespace
+
+TEST_CASE("DownloadPredictor: Predicts recorded reads", "[video_core]") {
+    DownloadPredictor predictor;
+    REQUIRE(predictor.Empty());
+    predictor.RecordRead(Area(4 * PAGE, 8 * PAGE), 0);
+    REQUIRE(predictor.IsPredicted(4 * PAGE, PAGE));
+    REQUIRE(predictor.IsPredicted(7 * PAGE, 4 * PAGE));
+    REQUIRE(predictor.IsPredicted(0, 5 * PAGE));
+    REQUIRE(!predictor.IsPredicted(0, 4 * PAGE));
+    REQUIRE(!predictor.IsPredicted(8 * PAGE, PAGE));
+}
+
+TEST_CASE("DownloadPredictor: Merges overlapping reads", "[video_core]") {
+    DownloadPredictor predictor;
+    predictor.RecordRead(Area(0, 2 * PAGE), 0);
+    predictor.RecordRead(Area(4 * PAGE, 6 * PAGE), 0);
+    predictor.RecordRead(Area(PAGE, 5 * PAGE), 10);
+    REQUIRE(predictor.IsPredicted(3 * PAGE, PAGE));
+
+    // The merged area keeps the most recent read
+    predictor.Tick(DownloadPredictor::MAX_IDLE_FRAMES + 10);
+    REQUIRE(predictor.IsPredicted(0, PAGE));
+    REQUIRE(predictor.IsPredicted(5 * PAGE, PAGE));
+    predictor.Tick(DownloadPredictor::MAX_IDLE_FRAMES + 11);
+    REQUIRE(predictor.Empty());
+}
+
+TEST_CASE("DownloadPredictor: Forgets idle areas", "[video_core]") {
+    DownloadPredictor predictor;
+    predictor.RecordRead(Area(0, PAGE), 0);
+    predictor.RecordRead(Area(2 * PAGE, 3 * PAGE), 100);
+    predictor.Tick(DownloadPredictor::MAX_IDLE_FRAMES + 1);
+    REQUIRE(!predictor.IsPredicted(0, PAGE));
+    REQUIRE(predictor.IsPredicted(2 * PAGE, PAGE));
+}
+
+TEST_CASE("DownloadPredictor: Bounds the number of areas", "[video_core]") {
+    DownloadPredictor predictor;
+    for (u64 i = 0; i <= DownloadPredictor::MAX_AREAS; ++i) {
+        predictor.RecordRead(Area(i * 2 * PAGE, (i * 2 + 1) * PAGE), i + 1);
+    }
+    // The least recently read area is dropped first
+    REQUIRE(!predictor.IsPredicted(0, PAGE));
+    REQUIRE(predictor.IsPredicted(2 * PAGE, PAGE));
+    REQUIRE(predictor.IsPredicted(DownloadPredictor::MAX_AREAS * 2 * PAGE, PAGE));
+}
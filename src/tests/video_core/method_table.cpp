@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/engines/method_table.h"
+
+namespace {
+using Tegra::Engines::MethodTable;
+
+constexpr MethodTable MakeTable() {
+    MethodTable table;
+    table.SetExecutable(10);
+    table.SetBulkRange(100, 116);
+    table.SetExecutableRange(0xE00, MethodTable::NUM_METHODS);
+    return table;
+}
+
+constexpr MethodTable TABLE = MakeTable();
+} // Anonymous namespace
+
+TEST_CASE("MethodTable: Executable methods", "[video_core]") {
+    STATIC_REQUIRE(TABLE.IsExecutable(10));
+    STATIC_REQUIRE(!TABLE.IsExecutable(11));
+    STATIC_REQUIRE(TABLE.IsExecutable(100));
+    STATIC_REQUIRE(TABLE.IsExecutable(0xE00));
+    STATIC_REQUIRE(TABLE.IsExecutable(MethodTable::NUM_METHODS + 5));
+}
+
+TEST_CASE("MethodTable: Sinkable runs", "[video_core]") {
+    REQUIRE(TABLE.CountSinkable(0, 100) == 10);
+    REQUIRE(TABLE.CountSinkable(0, 4) == 4);
+    REQUIRE(TABLE.CountSinkable(10, 4) == 0);
+    // Runs crossing several words stop at the next executable method
+    REQUIRE(TABLE.CountSinkable(11, 1000) == 89);
+    REQUIRE(TABLE.CountSinkable(116, 0x2000) == 0xE00 - 116);
+    REQUIRE(TABLE.CountSinkable(MethodTable::NUM_METHODS, 8) == 0);
+}
+
+TEST_CASE("MethodTable: Bulk runs", "[video_core]") {
+    REQUIRE(TABLE.CountBulk(100, 32) == 16);
+    REQUIRE(TABLE.CountBulk(110, 32) == 6);
+    REQUIRE(TABLE.CountBulk(110, 3) == 3);
+    REQUIRE(TABLE.CountBulk(10, 32) == 0);
+    REQUIRE(TABLE.CountBulk(0xE00, 32) == 0);
+}
@@ -23,6 +23,8 @@ BufferCache<P>::BufferCache(Tegra::MaxwellDeviceMemoryManager& device_memory_, R
     void(slot_buffers.insert(runtime, NullBufferParams{}));
     gpu_modified_ranges.Clear();
     inline_buffer_id = NULL_BUFFER_ID;
+    use_predictive_downloads = Settings::values.use_predictive_downloads.GetValue() &&
+                               Settings::values.use_reactive_flushing.GetValue();
 
     if (!runtime.CanReportMemoryUsage()) {
         minimum_memory = DEFAULT_EXPECTED_MEMORY;
@@ -99,6 +101,9 @@ void BufferCache<P>::TickFrame() {
     }
     ++frame_tick;
     delayed_destruction_ring.Tick();
+    if (use_predictive_downloads) {
+        download_predictor.Tick(frame_tick);
+    }
 
     for (auto& buffer : async_buffers_death_ring) {
         runtime.FreeDeferredStagingBuffer(buffer);
@@ -156,6 +161,14 @@ std::optional<VideoCore::RasterizerDownloadArea> BufferCache<P>::GetFlushArea(DA
     DAddr device_addr_end_aligned = Common::AlignUp(device_addr + size, Core::DEVICE_PAGESIZE);
     area->start_address = device_addr_start_aligned;
     area->end_address = device_addr_end_aligned;
+    if (use_predictive_downloads) {
+        // Only predicted areas are downloaded when their fence is signaled, the rest is flushed
+        const u64 aligned_size = device_addr_end_aligned - device_addr_start_aligned;
+        area->preemtive = download_predictor.IsPredicted(device_addr_start_aligned, aligned_size) ||
+                          !IsRegionGpuModified(device_addr_start_aligned, aligned_size);
+        download_predictor.RecordRead(*area, frame_tick);
+        return area;
+    }
     if (memory_tracker.IsRegionPreflushable(device_addr, size)) {
         area->preemtive = true;
         return area;
@@ -575,6 +588,11 @@ void BufferCache<P>::CommitAsyncFlushesHigh() {
                             largest_copy = std::max(largest_copy, new_size);
                         };
 
+                        if (use_predictive_downloads &&
+                            !download_predictor.IsPredicted(device_addr_out, range_size)) {
+                            // Left to be flushed when the CPU reads it
+                            return;
+                        }
                         gpu_modified_ranges.ForEachInRange(device_addr_out, range_size,
                                                            add_download);
                     });
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/cityhash.h"
+#include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/settings.h"
 #include "core/core.h"
@@ -13,6 +14,8 @@
 
 namespace Tegra {
 
+using Engines::MethodTable;
+
 constexpr u32 MacroRegistersStart = 0xE00;
 // constexpr u32 ComputeInline = 0x6D;
 
@@ -21,7 +24,13 @@ DmaPusher::DmaPusher(Core::System& system_, GPU& gpu_, MemoryManager& memory_man
     : gpu{gpu_}, system{system_}, memory_manager{memory_manager_}, puller{gpu_, memory_manager_,
                                                                           *this, channel_state_} {}
 
-DmaPusher::~DmaPusher() = default;
+DmaPusher::~DmaPusher() {
+    LOG_DEBUG(HW_GPU,
+              "DMA pusher: {} headers, {} puller methods, {} sunk methods, {} executed methods, "
+              "{} bulk calls writing {} words",
+              counters.command_headers, counters.puller_methods, counters.sunk_methods,
+              counters.executed_methods, counters.bulk_calls, counters.bulk_words);
+}
 
 MICROPROFILE_DEFINE(DispatchCalls, "GPU", "Execute command buffer", MP_RGB(128, 128, 192));
 
@@ -126,22 +135,27 @@ void DmaPusher::ProcessCommands(std::span<const CommandHeader> commands) {
         if (dma_state.method_count) {
             // Data word of methods command
             dma_state.dma_word_offset = static_cast<u32>(index * sizeof(u32));
+            const u32 max_write = static_cast<u32>(
+                std::min<std::size_t>(index + dma_state.method_count, commands.size()) - index);
             if (dma_state.non_incrementing) {
-                const u32 max_write = static_cast<u32>(
-                    std::min<std::size_t>(index + dma_state.method_count, commands.size()) - index);
                 CallMultiMethod(&command_header.argument, max_write);
                 dma_state.method_count -= max_write;
                 dma_state.is_last_call = true;
                 index += max_write;
                 continue;
-            } else {
-                dma_state.is_last_call = dma_state.method_count <= 1;
-                CallMethod(command_header.argument);
             }
-
-            if (!dma_state.non_incrementing) {
-                dma_state.method++;
+            if (!dma_increment_once && dma_state.method >= non_puller_methods) {
+                const u32 written = CallIncrementingMethods(&command_header.argument, max_write);
+                if (written != 0) {
+                    dma_state.method += written;
+                    dma_state.method_count -= written;
+                    index += written;
+                    continue;
+                }
             }
+            dma_state.is_last_call = dma_state.method_count <= 1;
+            CallMethod(command_header.argument);
+            dma_state.method++;
 
             if (dma_increment_once) {
                 dma_state.non_incrementing = true;
@@ -150,6 +164,7 @@ void DmaPusher::ProcessCommands(std::span<const CommandHeader> commands) {
             dma_state.method_count--;
         } else {
             // No command active - this is the first word of a new one
+            ++counters.command_headers;
             switch (command_header.mode) {
             case SubmissionMode::Increasing:
                 SetState(command_header);
@@ -189,8 +204,9 @@ void DmaPusher::SetState(const CommandHeader& command_header) {
     dma_state.method_count = command_header.method_count;
 }
 
-void DmaPusher::CallMethod(u32 argument) const {
+void DmaPusher::CallMethod(u32 argument) {
     if (dma_state.method < non_puller_methods) {
+        ++counters.puller_methods;
         puller.CallPullerMethod(Engines::Puller::MethodCall{
             dma_state.method,
             argument,
@@ -199,17 +215,21 @@ void DmaPusher::CallMethod(u32 argument) const {
         });
     } else {
         auto subchannel = subchannels[dma_state.subchannel];
-        if (!subchannel->execution_mask[dma_state.method]) [[likely]] {
+        if (!subchannel->execution_mask.IsExecutable(dma_state.method)) [[likely]] {
+            ++counters.sunk_methods;
             subchannel->method_sink.emplace_back(dma_state.method, argument);
             return;
         }
+        ++counters.executed_methods;
         subchannel->ConsumeSink();
         subchannel->current_dma_segment = dma_state.dma_get + dma_state.dma_word_offset;
         subchannel->CallMethod(dma_state.method, argument, dma_state.is_last_call);
     }
 }
 
-void DmaPusher::CallMultiMethod(const u32* base_start, u32 num_methods) const {
+void DmaPusher::CallMultiMethod(const u32* base_start, u32 num_methods) {
+    ++counters.bulk_calls;
+    counters.bulk_words += num_methods;
     if (dma_state.method < non_puller_methods) {
         puller.CallMultiMethod(dma_state.method, dma_state.subchannel, base_start, num_methods,
                                dma_state.method_count);
@@ -222,6 +242,34 @@ void DmaPusher::CallMultiMethod(const u32* base_start, u32 num_methods) const {
     }
 }
 
+u32 DmaPusher::CallIncrementingMethods(const u32* arguments, u32 num_methods) {
+    auto subchannel = subchannels[dma_state.subchannel];
+    const u32 method = dma_state.method;
+    const MethodTable& table = subchannel->execution_mask;
+
+    // Registers that only store their value are deferred as a whole run
+    const u32 num_sunk = table.CountSinkable(method, num_methods);
+    if (num_sunk != 0) {
+        counters.sunk_methods += num_sunk;
+        for (u32 i = 0; i < num_sunk; ++i) {
+            subchannel->method_sink.emplace_back(method + i, arguments[i]);
+        }
+        return num_sunk;
+    }
+
+    // Runs over a register window, like const buffer data, are uploaded in one call
+    const u32 num_bulk = table.CountBulk(method, num_methods);
+    if (num_bulk < 2) {
+        return 0;
+    }
+    ++counters.bulk_calls;
+    counters.bulk_words += num_bulk;
+    subchannel->ConsumeSink();
+    subchannel->current_dma_segment = dma_state.dma_get + dma_state.dma_word_offset;
+    subchannel->CallMultiMethod(method, arguments, num_bulk, dma_state.method_count);
+    return num_bulk;
+}
+
 void DmaPusher::BindRasterizer(VideoCore::RasterizerInterface* rasterizer) {
     puller.BindRasterizer(rasterizer);
 }
@@ -120,6 +120,16 @@ struct CommandList final {
  */
 class DmaPusher final {
 public:
+    /// Number of words processed by each dispatch path, showing the method mix of a channel
+    struct Counters {
+        u64 command_headers;  ///< Method headers decoded
+        u64 puller_methods;   ///< Words written to puller methods one at a time
+        u64 sunk_methods;     ///< Words deferred to the engine's method sink
+        u64 executed_methods; ///< Words executed by the engine one at a time
+        u64 bulk_calls;       ///< Bursts handed to the engine in one call
+        u64 bulk_words;       ///< Words written by those bursts
+    };
+
     explicit DmaPusher(Core::System& system_, GPU& gpu_, MemoryManager& memory_manager_,
                        Control::ChannelState& channel_state_);
     ~DmaPusher();
@@ -138,6 +148,10 @@ public:
 
     void BindRasterizer(VideoCore::RasterizerInterface* rasterizer);
 
+    [[nodiscard]] const Counters& GetCounters() const noexcept {
+        return counters;
+    }
+
 private:
     static constexpr u32 non_puller_methods = 0x40;
     static constexpr u32 max_subchannels = 8;
@@ -146,8 +160,12 @@ private:
 
     void SetState(const CommandHeader& command_header);
 
-    void CallMethod(u32 argument) const;
-    void CallMultiMethod(const u32* base_start, u32 num_methods) const;
+    void CallMethod(u32 argument);
+    void CallMultiMethod(const u32* base_start, u32 num_methods);
+
+    /// Dispatches the leading words of an incrementing burst to an engine in bulk.
+    /// @returns Number of words dispatched, zero when the first method has to be called alone
+    u32 CallIncrementingMethods(const u32* arguments, u32 num_methods);
 
     Common::ScratchBuffer<CommandHeader>
         command_headers; ///< Buffer for list of commands fetched at once
@@ -168,6 +186,7 @@ private:
 
     DmaState dma_state{};
     bool dma_increment_once{};
+    Counters counters{};
 
     const bool ib_enable{true}; ///< IB mode enabled
 
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "common/common_types.h"
+#include "video_core/rasterizer_download_area.h"
+
+namespace VideoCommon {
+
+/**
+ * Learns which areas of guest memory the CPU reads back after the GPU writes them.
+ *
+ * The caches record every download area requested by a CPU read, and download the areas that
+ * were read recently as soon as the GPU work writing them is submitted. Later CPU reads are then
+ * served from memory that was already downloaded instead of stalling on the GPU. Areas that the
+ * CPU has not read for a while are forgotten, so their downloads stop.
+ */
+class DownloadPredictor {
+public:
+    /// Number of frames an area is predicted for after its last read
+    static constexpr u64 MAX_IDLE_FRAMES = 300;
+
+    /// Upper bound of tracked areas, the least recently read ones are dropped past it
+    static constexpr size_t MAX_AREAS = 256;
+
+    /// Records a CPU read of the given area, merging it with the areas it overlaps.
+    void RecordRead(const VideoCore::RasterizerDownloadArea& area, u64 frame) {
+        const DAddr start = area.start_address;
+        const DAddr end = area.end_address;
+        if (start >= end) {
+            return;
+        }
+        auto it = std::ranges::lower_bound(areas, start, {}, &Area::end);
+        Area merged{start, end, frame};
+        while (it != areas.end() && it->start <= end) {
+            merged.start = std::min(merged.start, it->start);
+            merged.end = std::max(merged.end, it->end);
+            it = areas.erase(it);
+        }
+        areas.insert(it, merged);
+        if (areas.size() > MAX_AREAS) {
+            areas.erase(std::ranges::min_element(areas, {}, &Area::last_read));
+        }
+    }
+
+    /// Returns true when the range overlaps an area read in the last MAX_IDLE_FRAMES frames.
+    [[nodiscard]] bool IsPredicted(DAddr addr, u64 size) const {
+        const auto it = std::ranges::upper_bound(areas, addr, {}, &Area::end);
+        return it != areas.end() && it->start < addr + size;
+    }
+
+    /// Forgets the areas that have not been read in the last MAX_IDLE_FRAMES frames.
+    void Tick(u64 frame) {
+        std::erase_if(areas, [frame](const Area& area) {
+            return frame - area.last_read > MAX_IDLE_FRAMES;
+        });
+    }
+
+    /// Returns true when no area is predicted.
+    [[nodiscard]] bool Empty() const noexcept {
+        return areas.empty();
+    }
+
+private:
+    struct Area {
+        DAddr start;
+        DAddr end;
+        u64 last_read;
+    };
+
+    /// Sorted and non overlapping areas
+    std::vector<Area> areas;
+};
+
+} // namespace VideoCommon
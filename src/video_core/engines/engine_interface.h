@@ -3,11 +3,10 @@
 
 #pragma once
 
-#include <bitset>
-#include <limits>
 #include <vector>
 
 #include "common/common_types.h"
+#include "video_core/engines/method_table.h"
 
 namespace Tegra::Engines {
 
@@ -21,6 +20,9 @@ enum class EngineTypes : u32 {
 
 class EngineInterface {
 public:
+    explicit EngineInterface(const MethodTable& execution_mask_)
+        : execution_mask{execution_mask_} {}
+
     virtual ~EngineInterface() = default;
 
     /// Write the value to the register identified by method.
@@ -37,7 +39,7 @@ public:
         ConsumeSinkImpl();
     }
 
-    std::bitset<std::numeric_limits<u16>::max()> execution_mask{};
+    const MethodTable& execution_mask;
     std::vector<std::pair<u32, u32>> method_sink{};
     bool current_dirty{};
     GPUVAddr current_dma_segment;
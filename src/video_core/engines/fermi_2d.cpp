@@ -21,14 +21,22 @@ namespace Tegra::Engines {
 
 using namespace Texture;
 
-Fermi2D::Fermi2D(MemoryManager& memory_manager_) : memory_manager{memory_manager_} {
+namespace {
+constexpr MethodTable MakeExecutionMask() {
+    MethodTable table;
+    table.SetExecutable(static_cast<u32>(FERMI2D_REG_INDEX(pixels_from_memory.src_y0) + 1));
+    return table;
+}
+
+constexpr MethodTable EXECUTION_MASK = MakeExecutionMask();
+} // Anonymous namespace
+
+Fermi2D::Fermi2D(MemoryManager& memory_manager_)
+    : EngineInterface{EXECUTION_MASK}, memory_manager{memory_manager_} {
     sw_blitter = std::make_unique<Blitter::SoftwareBlitEngine>(memory_manager);
     // Nvidia's OpenGL driver seems to assume these values
     regs.src.depth = 1;
     regs.dst.depth = 1;
-
-    execution_mask.reset();
-    execution_mask[FERMI2D_REG_INDEX(pixels_from_memory.src_y0) + 1] = true;
 }
 
 Fermi2D::~Fermi2D() = default;
@@ -12,14 +12,21 @@
 #include "video_core/textures/decoders.h"
 
 namespace Tegra::Engines {
+namespace {
+constexpr MethodTable MakeExecutionMask() {
+    MethodTable table;
+    table.SetExecutable(static_cast<u32>(KEPLER_COMPUTE_REG_INDEX(exec_upload)));
+    table.SetExecutable(static_cast<u32>(KEPLER_COMPUTE_REG_INDEX(data_upload)));
+    table.SetExecutable(static_cast<u32>(KEPLER_COMPUTE_REG_INDEX(launch)));
+    return table;
+}
+
+constexpr MethodTable EXECUTION_MASK = MakeExecutionMask();
+} // Anonymous namespace
 
 KeplerCompute::KeplerCompute(Core::System& system_, MemoryManager& memory_manager_)
-    : system{system_}, memory_manager{memory_manager_}, upload_state{memory_manager, regs.upload} {
-    execution_mask.reset();
-    execution_mask[KEPLER_COMPUTE_REG_INDEX(exec_upload)] = true;
-    execution_mask[KEPLER_COMPUTE_REG_INDEX(data_upload)] = true;
-    execution_mask[KEPLER_COMPUTE_REG_INDEX(launch)] = true;
-}
+    : EngineInterface{EXECUTION_MASK}, system{system_}, memory_manager{memory_manager_},
+      upload_state{memory_manager, regs.upload} {}
 
 KeplerCompute::~KeplerCompute() = default;
 
@@ -10,18 +10,24 @@
 #include "video_core/rasterizer_interface.h"
 
 namespace Tegra::Engines {
+namespace {
+constexpr MethodTable MakeExecutionMask() {
+    MethodTable table;
+    table.SetExecutable(static_cast<u32>(KEPLERMEMORY_REG_INDEX(exec)));
+    table.SetExecutable(static_cast<u32>(KEPLERMEMORY_REG_INDEX(data)));
+    return table;
+}
+
+constexpr MethodTable EXECUTION_MASK = MakeExecutionMask();
+} // Anonymous namespace
 
 KeplerMemory::KeplerMemory(Core::System& system_, MemoryManager& memory_manager)
-    : system{system_}, upload_state{memory_manager, regs.upload} {}
+    : EngineInterface{EXECUTION_MASK}, system{system_}, upload_state{memory_manager, regs.upload} {}
 
 KeplerMemory::~KeplerMemory() = default;
 
 void KeplerMemory::BindRasterizer(VideoCore::RasterizerInterface* rasterizer_) {
     upload_state.BindRasterizer(rasterizer_);
-
-    execution_mask.reset();
-    execution_mask[KEPLERMEMORY_REG_INDEX(exec)] = true;
-    execution_mask[KEPLERMEMORY_REG_INDEX(data)] = true;
 }
 
 void KeplerMemory::ConsumeSinkImpl() {
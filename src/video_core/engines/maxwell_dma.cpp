@@ -28,12 +28,22 @@ namespace Tegra::Engines {
 
 using namespace Texture;
 
-MaxwellDMA::MaxwellDMA(Core::System& system_, MemoryManager& memory_manager_)
-    : system{system_}, memory_manager{memory_manager_} {
-    execution_mask.reset();
-    execution_mask[offsetof(Regs, launch_dma) / sizeof(u32)] = true;
+namespace {
+/// Method of the launch_dma register, its position is asserted with the register layout
+constexpr u32 LaunchDmaMethod = 0x300 / sizeof(u32);
+
+constexpr MethodTable MakeExecutionMask() {
+    MethodTable table;
+    table.SetExecutable(LaunchDmaMethod);
+    return table;
 }
 
+constexpr MethodTable EXECUTION_MASK = MakeExecutionMask();
+} // Anonymous namespace
+
+MaxwellDMA::MaxwellDMA(Core::System& system_, MemoryManager& memory_manager_)
+    : EngineInterface{EXECUTION_MASK}, system{system_}, memory_manager{memory_manager_} {}
+
 MaxwellDMA::~MaxwellDMA() = default;
 
 void MaxwellDMA::BindRasterizer(VideoCore::RasterizerInterface* rasterizer_) {
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+#include "common/common_types.h"
+
+namespace Tegra::Engines {
+
+/**
+ * Describes how the DMA pusher dispatches the methods of an engine.
+ *
+ * Methods that are not executable only store their argument, so the pusher defers them to the
+ * engine's method sink. Bulk methods are executable methods that alias the same register window,
+ * writing any of them in a burst is the same as writing the first one repeatedly, so incrementing
+ * bursts over them are handed to the engine in a single call.
+ *
+ * Tables are built at compile time by each engine.
+ */
+class MethodTable {
+public:
+    /// Command headers encode methods in 13 bits
+    static constexpr u32 NUM_METHODS = 1U << 13;
+
+    constexpr void SetExecutable(u32 method) {
+        executable[method / 64] |= u64{1} << (method % 64);
+    }
+
+    constexpr void SetExecutableRange(u32 begin, u32 end) {
+        for (u32 method = begin; method < end; ++method) {
+            SetExecutable(method);
+        }
+    }
+
+    constexpr void SetBulkRange(u32 begin, u32 end) {
+        for (u32 method = begin; method < end; ++method) {
+            SetExecutable(method);
+            bulk[method / 64] |= u64{1} << (method % 64);
+        }
+    }
+
+    /// Methods past the table are executable, so that the engine can report them.
+    [[nodiscard]] constexpr bool IsExecutable(u32 method) const {
+        return method >= NUM_METHODS || ((executable[method / 64] >> (method % 64)) & 1) != 0;
+    }
+
+    /// Returns how many methods starting at method, up to max_count, are not executable.
+    [[nodiscard]] u32 CountSinkable(u32 method, u32 max_count) const {
+        return CountRun(executable, method, max_count, false);
+    }
+
+    /// Returns how many methods starting at method, up to max_count, are bulk methods.
+    [[nodiscard]] u32 CountBulk(u32 method, u32 max_count) const {
+        return CountRun(bulk, method, max_count, true);
+    }
+
+private:
+    using Bits = std::array<u64, NUM_METHODS / 64>;
+
+    static u32 CountRun(const Bits& bits, u32 method, u32 max_count, bool value) {
+        u32 count = 0;
+        while (count < max_count && method < NUM_METHODS) {
+            const u64 word = value ? bits[method / 64] : ~bits[method / 64];
+            const u32 run = static_cast<u32>(std::countr_one(word >> (method % 64)));
+            const u32 word_left = 64 - method % 64;
+            count += std::min(run, word_left);
+            if (run < word_left) {
+                break;
+            }
+            method += word_left;
+        }
+        return std::min(count, max_count);
+    }
+
+    Bits executable{};
+    Bits bulk{};
+};
+
+} // namespace Tegra::Engines
@@ -36,8 +36,7 @@ static void RunThread(std::stop_token stop_token, Core::System& system,
     CommandDataContainer next;
 
     while (!stop_token.stop_requested()) {
-        state.queue.PopWait(next, stop_token);
-        if (stop_token.stop_requested()) {
+        if (!state.queue.PopWait(next, stop_token)) {
             break;
         }
         if (auto* submit_list = std::get_if<SubmitListCommand>(&next.data)) {
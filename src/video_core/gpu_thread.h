@@ -10,8 +10,8 @@
 #include <thread>
 #include <variant>
 
-#include "common/bounded_threadsafe_queue.h"
 #include "common/polyfill_thread.h"
+#include "common/spsc_ring.h"
 #include "video_core/framebuffer_config.h"
 
 namespace Tegra {
@@ -89,7 +89,8 @@ struct CommandDataContainer {
 
 /// Struct used to synchronize the GPU thread
 struct SynchState final {
-    using CommandQueue = Common::MPSCQueue<CommandDataContainer>;
+    /// Producers are serialized by write_lock, so the GPU thread is fed through a SPSC ring
+    using CommandQueue = Common::SPSCRing<CommandDataContainer>;
     std::mutex write_lock;
     CommandQueue queue;
     u64 last_fence{};
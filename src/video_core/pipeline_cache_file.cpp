@@ -0,0 +1,591 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "common/cityhash.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/zstd_compression.h"
+#include "video_core/pipeline_cache_file.h"
+
+namespace VideoCommon {
+namespace {
+constexpr std::array<char, 8> MAGIC_NUMBER{'c', 'i', 't', 'r', 'o', 'n', 'p', 'c'};
+constexpr std::array<char, 8> LEGACY_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'c', 'a', 'c', 'h'};
+constexpr u32 FORMAT_VERSION = 1;
+constexpr u32 RECORD_MAGIC = 0x43455250; // "PREC"
+
+/// Number of appended pipelines after which the index is rewritten
+constexpr size_t INDEX_FLUSH_INTERVAL = 64;
+
+enum class RecordType : u32 {
+    Blob = 1,
+    Pipeline = 2,
+    Index = 3,
+};
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    u32 format_version;
+    u32 cache_version;
+    u64 index_offset; ///< Zero when the index has to be rebuilt by scanning the records
+    u64 reserved;
+};
+static_assert(sizeof(FileHeader) == 32);
+
+struct RecordHeader {
+    u32 magic;
+    RecordType type;
+    u32 compressed_size;
+    u32 uncompressed_size;
+    u64 hash;     ///< Content hash for blobs, key hash for pipelines
+    u64 checksum; ///< Hash of the compressed payload
+};
+static_assert(sizeof(RecordHeader) == 32);
+
+FileHeader MakeHeader(u32 cache_version, u64 index_offset) {
+    return FileHeader{
+        .magic = MAGIC_NUMBER,
+        .format_version = FORMAT_VERSION,
+        .cache_version = cache_version,
+        .index_offset = index_offset,
+        .reserved = 0,
+    };
+}
+
+/// Returns the record header at the given offset, or nullopt if it is not a valid record.
+std::optional<RecordHeader> ReadRecordHeader(std::span<const u8> data, u64 offset) {
+    if (offset > data.size() || data.size() - offset < sizeof(RecordHeader)) {
+        return std::nullopt;
+    }
+    RecordHeader header;
+    std::memcpy(&header, data.data() + offset, sizeof(header));
+    if (header.magic != RECORD_MAGIC ||
+        data.size() - offset - sizeof(RecordHeader) < header.compressed_size) {
+        return std::nullopt;
+    }
+    return header;
+}
+
+/// Verifies and decompresses the payload of a record.
+std::optional<std::vector<u8>> ReadPayload(std::span<const u8> data, u64 offset, u32 type,
+                                           u32 compressed_size, u32 uncompressed_size,
+                                           u64 checksum) {
+    const std::optional<RecordHeader> header{ReadRecordHeader(data, offset)};
+    if (!header || static_cast<u32>(header->type) != type ||
+        header->compressed_size != compressed_size ||
+        header->uncompressed_size != uncompressed_size || header->checksum != checksum) {
+        return std::nullopt;
+    }
+    const auto payload{data.subspan(offset + sizeof(RecordHeader), compressed_size)};
+    if (Common::CityHash64(reinterpret_cast<const char*>(payload.data()), payload.size()) !=
+        checksum) {
+        return std::nullopt;
+    }
+    std::vector<u8> result{Common::Compression::DecompressDataZSTD(payload)};
+    if (result.size() != uncompressed_size) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+template <typename T>
+void WriteValue(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+T ReadValue(std::istream& stream) {
+    T value{};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+}
+} // Anonymous namespace
+
+PipelineCacheFile::~PipelineCacheFile() {
+    Flush();
+}
+
+PipelineCacheFile::SerializedEnvironment PipelineCacheFile::Serialize(
+    const GenericEnvironment& env) {
+    std::ostringstream stream;
+    env.Serialize(stream);
+    return SerializedEnvironment{
+        .metadata = std::move(stream).str(),
+        .code = env.CodeBytes(),
+    };
+}
+
+PipelineCacheFile::SerializedEnvironment PipelineCacheFile::Serialize(const FileEnvironment& env) {
+    std::ostringstream stream;
+    env.Serialize(stream);
+    return SerializedEnvironment{
+        .metadata = std::move(stream).str(),
+        .code = env.CodeBytes(),
+    };
+}
+
+void PipelineCacheFile::Reset(const std::filesystem::path& filename, u32 cache_version) {
+    std::scoped_lock lock{mutex};
+    path = filename;
+    version = cache_version;
+    index.clear();
+    stored_blobs.clear();
+    stored_pipelines.clear();
+    data_end = sizeof(FileHeader);
+    index_dirty = true;
+    appends_since_flush = 0;
+
+    Common::FS::IOFile file(path, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::BinaryFile);
+    if (!file.IsOpen() || !file.WriteObject(MakeHeader(version, 0))) {
+        LOG_ERROR(Common_Filesystem, "Failed to create pipeline cache file {}",
+                  Common::FS::PathToUTF8String(path));
+        path.clear();
+    }
+}
+
+void PipelineCacheFile::LoadImpl(std::stop_token stop_loading,
+                                 const std::filesystem::path& filename, u32 cache_version,
+                                 size_t compute_key_size, size_t graphics_key_size,
+                                 RawComputeLoader load_compute, RawGraphicsLoader load_graphics) {
+    const auto read_file{[&filename] {
+        std::vector<u8> contents;
+        Common::FS::IOFile file(filename, Common::FS::FileAccessMode::Read,
+                                Common::FS::FileType::BinaryFile);
+        if (file.IsOpen()) {
+            contents.resize(file.GetSize());
+            if (file.ReadSpan(std::span(contents)) != contents.size()) {
+                contents.clear();
+            }
+        }
+        return contents;
+    }};
+    std::vector<u8> data{read_file()};
+    if (data.size() >= LEGACY_MAGIC_NUMBER.size() &&
+        std::equal(LEGACY_MAGIC_NUMBER.begin(), LEGACY_MAGIC_NUMBER.end(), data.begin())) {
+        if (MigrateImpl(filename, cache_version, compute_key_size, graphics_key_size)) {
+            data = read_file();
+        }
+    }
+    FileHeader header{};
+    if (data.size() >= sizeof(header)) {
+        std::memcpy(&header, data.data(), sizeof(header));
+    }
+    if (header.magic != MAGIC_NUMBER || header.format_version != FORMAT_VERSION ||
+        header.cache_version != cache_version) {
+        if (!data.empty()) {
+            LOG_INFO(Common_Filesystem, "Deleting old pipeline cache");
+        }
+        Reset(filename, cache_version);
+        return;
+    }
+
+    // Use the index when it is intact, otherwise rebuild it from the records
+    std::vector<IndexEntry> entries;
+    u64 end_of_records{sizeof(FileHeader)};
+    bool rebuilt_index{true};
+    if (header.index_offset != 0) {
+        const std::optional<RecordHeader> index_header{
+            ReadRecordHeader(data, header.index_offset)};
+        if (index_header && index_header->type == RecordType::Index &&
+            index_header->uncompressed_size % sizeof(IndexEntry) == 0) {
+            const auto payload{ReadPayload(
+                data, header.index_offset, static_cast<u32>(RecordType::Index),
+                index_header->compressed_size, index_header->uncompressed_size,
+                index_header->checksum)};
+            if (payload) {
+                entries.resize(payload->size() / sizeof(IndexEntry));
+                std::memcpy(entries.data(), payload->data(), payload->size());
+                end_of_records = header.index_offset;
+                rebuilt_index = false;
+            }
+        }
+    }
+    if (rebuilt_index) {
+        u64 offset{sizeof(FileHeader)};
+        while (const std::optional<RecordHeader> record{ReadRecordHeader(data, offset)}) {
+            if (record->type == RecordType::Index) {
+                break;
+            }
+            entries.push_back(IndexEntry{
+                .offset = offset,
+                .type = static_cast<u32>(record->type),
+                .compressed_size = record->compressed_size,
+                .uncompressed_size = record->uncompressed_size,
+                .reserved = 0,
+                .hash = record->hash,
+                .checksum = record->checksum,
+            });
+            offset += sizeof(RecordHeader) + record->compressed_size;
+        }
+        end_of_records = offset;
+        LOG_INFO(Common_Filesystem, "Rebuilt pipeline cache index with {} records",
+                 entries.size());
+    }
+
+    const auto read_payload{[&](const IndexEntry& entry) {
+        return ReadPayload(data, entry.offset, entry.type, entry.compressed_size,
+                           entry.uncompressed_size, entry.checksum);
+    }};
+    std::unordered_map<u64, std::vector<u8>> blobs;
+    std::vector<IndexEntry> blob_entries;
+    std::vector<IndexEntry> valid_entries;
+    valid_entries.reserve(entries.size());
+    size_t num_dropped{};
+    size_t num_duplicates{};
+    for (const IndexEntry& entry : entries) {
+        if (entry.type != static_cast<u32>(RecordType::Blob)) {
+            continue;
+        }
+        if (blobs.contains(entry.hash)) {
+            ++num_duplicates;
+            continue;
+        }
+        std::optional<std::vector<u8>> payload{read_payload(entry)};
+        if (!payload) {
+            ++num_dropped;
+            continue;
+        }
+        blobs.emplace(entry.hash, std::move(*payload));
+        blob_entries.push_back(entry);
+    }
+    // Walk the pipelines from the newest record so that only the latest copy of a key is kept
+    std::unordered_set<u64> loaded_pipelines;
+    std::unordered_set<u64> referenced_blobs;
+    for (auto it = entries.rbegin(); it != entries.rend(); ++it) {
+        const IndexEntry& entry{*it};
+        if (entry.type != static_cast<u32>(RecordType::Pipeline)) {
+            continue;
+        }
+        if (stop_loading.stop_requested()) {
+            return;
+        }
+        if (loaded_pipelines.contains(entry.hash)) {
+            ++num_duplicates;
+            continue;
+        }
+        const std::optional<std::vector<u8>> payload{read_payload(entry)};
+        if (!payload) {
+            ++num_dropped;
+            continue;
+        }
+        std::istringstream stream(
+            std::string(reinterpret_cast<const char*>(payload->data()), payload->size()));
+        stream.exceptions(std::ios::failbit);
+        try {
+            const u32 key_size{ReadValue<u32>(stream)};
+            std::vector<char> key(key_size);
+            stream.read(key.data(), key.size());
+            if (Common::CityHash64(key.data(), key.size()) != entry.hash) {
+                throw std::ios_base::failure("Invalid key hash");
+            }
+            const u32 num_envs{ReadValue<u32>(stream)};
+            if (num_envs == 0 || num_envs > Tegra::Engines::Maxwell3D::Regs::MaxShaderProgram) {
+                throw std::ios_base::failure("Invalid number of environments");
+            }
+            std::vector<FileEnvironment> envs(num_envs);
+            std::vector<u64> blob_hashes;
+            blob_hashes.reserve(num_envs);
+            for (FileEnvironment& env : envs) {
+                const u64 blob_hash{ReadValue<u64>(stream)};
+                const auto blob{blobs.find(blob_hash)};
+                if (blob == blobs.end()) {
+                    throw std::ios_base::failure("Missing code blob");
+                }
+                env.Deserialize(stream, blob->second);
+                blob_hashes.push_back(blob_hash);
+            }
+            const bool is_compute{envs.front().ShaderStage() == Shader::Stage::Compute};
+            if (key.size() != (is_compute ? compute_key_size : graphics_key_size)) {
+                throw std::ios_base::failure("Invalid key size");
+            }
+            valid_entries.push_back(entry);
+            loaded_pipelines.insert(entry.hash);
+            referenced_blobs.insert(blob_hashes.begin(), blob_hashes.end());
+            if (is_compute) {
+                load_compute(key, std::move(envs.front()));
+            } else {
+                load_graphics(key, std::move(envs));
+            }
+        } catch (const std::ios_base::failure& e) {
+            LOG_WARNING(Common_Filesystem, "Dropping pipeline cache record: {}", e.what());
+            ++num_dropped;
+        }
+    }
+    size_t num_unreferenced{};
+    for (const IndexEntry& entry : blob_entries) {
+        if (referenced_blobs.contains(entry.hash)) {
+            valid_entries.push_back(entry);
+        } else {
+            ++num_unreferenced;
+        }
+    }
+    std::ranges::sort(valid_entries, {}, &IndexEntry::offset);
+    LOG_INFO(Common_Filesystem,
+             "Loaded {} pipelines sharing {} code blobs from the pipeline cache, dropped {} "
+             "invalid, {} duplicate and {} unreferenced records",
+             loaded_pipelines.size(), referenced_blobs.size(), num_dropped, num_duplicates,
+             num_unreferenced);
+
+    std::scoped_lock lock{mutex};
+    const bool has_dead_records{valid_entries.size() != entries.size()};
+    if (has_dead_records) {
+        if (const std::optional<u64> end{Compact(filename, cache_version, data, valid_entries)}) {
+            end_of_records = *end;
+        }
+    }
+    path = filename;
+    version = cache_version;
+    index = std::move(valid_entries);
+    stored_blobs = std::move(referenced_blobs);
+    stored_pipelines = std::move(loaded_pipelines);
+    data_end = end_of_records;
+    index_dirty = rebuilt_index || has_dead_records;
+    appends_since_flush = 0;
+    if (index_dirty) {
+        FlushLocked();
+    }
+}
+
+void PipelineCacheFile::AppendImpl(std::span<const char> key,
+                                   std::span<const SerializedEnvironment> envs) {
+    std::scoped_lock lock{mutex};
+    if (path.empty()) {
+        return;
+    }
+    try {
+        AppendLocked(key, envs);
+    } catch (const std::ios_base::failure& e) {
+        LOG_ERROR(Common_Filesystem, "{}", e.what());
+        if (!Common::FS::RemoveFile(path)) {
+            LOG_ERROR(Common_Filesystem, "Failed to delete pipeline cache file {}",
+                      Common::FS::PathToUTF8String(path));
+        }
+        path.clear();
+    }
+}
+
+void PipelineCacheFile::AppendLocked(std::span<const char> key,
+                                     std::span<const SerializedEnvironment> envs) {
+    Common::FS::IOFile file(path, Common::FS::FileAccessMode::ReadWrite,
+                            Common::FS::FileType::BinaryFile);
+    if (!file.IsOpen()) {
+        LOG_ERROR(Common_Filesystem, "Failed to open pipeline cache file {}",
+                  Common::FS::PathToUTF8String(path));
+        return;
+    }
+    if (!index_dirty) {
+        // The index is about to be overwritten, make loaders scan the records instead
+        if (!file.WriteObject(MakeHeader(version, 0))) {
+            throw std::ios_base::failure("Failed to write header");
+        }
+        index_dirty = true;
+    }
+    const auto write_record{[&](RecordType type, u64 hash, std::span<const u8> payload) {
+        const std::vector<u8> compressed{
+            Common::Compression::CompressDataZSTDDefault(payload.data(), payload.size())};
+        const RecordHeader header{
+            .magic = RECORD_MAGIC,
+            .type = type,
+            .compressed_size = static_cast<u32>(compressed.size()),
+            .uncompressed_size = static_cast<u32>(payload.size()),
+            .hash = hash,
+            .checksum = Common::CityHash64(reinterpret_cast<const char*>(compressed.data()),
+                                           compressed.size()),
+        };
+        if (!file.Seek(static_cast<s64>(data_end)) || !file.WriteObject(header) ||
+            file.WriteSpan(std::span(compressed)) != compressed.size()) {
+            throw std::ios_base::failure("Failed to write record");
+        }
+        index.push_back(IndexEntry{
+            .offset = data_end,
+            .type = static_cast<u32>(type),
+            .compressed_size = header.compressed_size,
+            .uncompressed_size = header.uncompressed_size,
+            .reserved = 0,
+            .hash = hash,
+            .checksum = header.checksum,
+        });
+        data_end += sizeof(RecordHeader) + compressed.size();
+    }};
+
+    const u64 key_hash{Common::CityHash64(key.data(), key.size())};
+    if (stored_pipelines.contains(key_hash)) {
+        return;
+    }
+    std::ostringstream stream;
+    WriteValue(stream, static_cast<u32>(key.size()));
+    stream.write(key.data(), key.size());
+    WriteValue(stream, static_cast<u32>(envs.size()));
+    for (const SerializedEnvironment& env : envs) {
+        const u64 blob_hash{
+            Common::CityHash64(reinterpret_cast<const char*>(env.code.data()), env.code.size())};
+        if (!stored_blobs.contains(blob_hash)) {
+            write_record(RecordType::Blob, blob_hash, env.code);
+            stored_blobs.insert(blob_hash);
+        }
+        WriteValue(stream, blob_hash);
+        stream.write(env.metadata.data(), env.metadata.size());
+    }
+    const std::string pipeline{std::move(stream).str()};
+    write_record(RecordType::Pipeline, key_hash,
+                 std::span(reinterpret_cast<const u8*>(pipeline.data()), pipeline.size()));
+    stored_pipelines.insert(key_hash);
+
+    if (++appends_since_flush >= INDEX_FLUSH_INTERVAL) {
+        file.Close();
+        FlushLocked();
+    }
+}
+
+void PipelineCacheFile::Flush() {
+    std::scoped_lock lock{mutex};
+    FlushLocked();
+}
+
+void PipelineCacheFile::FlushLocked() {
+    if (path.empty() || !index_dirty) {
+        return;
+    }
+    Common::FS::IOFile file(path, Common::FS::FileAccessMode::ReadWrite,
+                            Common::FS::FileType::BinaryFile);
+    if (!file.IsOpen()) {
+        return;
+    }
+    const std::span<const u8> payload(reinterpret_cast<const u8*>(index.data()),
+                                      index.size() * sizeof(IndexEntry));
+    const std::vector<u8> compressed{
+        Common::Compression::CompressDataZSTDDefault(payload.data(), payload.size())};
+    const RecordHeader header{
+        .magic = RECORD_MAGIC,
+        .type = RecordType::Index,
+        .compressed_size = static_cast<u32>(compressed.size()),
+        .uncompressed_size = static_cast<u32>(payload.size()),
+        .hash = 0,
+        .checksum = Common::CityHash64(reinterpret_cast<const char*>(compressed.data()),
+                                       compressed.size()),
+    };
+    const u64 file_size{data_end + sizeof(RecordHeader) + compressed.size()};
+    if (!file.Seek(static_cast<s64>(data_end)) || !file.WriteObject(header) ||
+        file.WriteSpan(std::span(compressed)) != compressed.size() || !file.SetSize(file_size) ||
+        !file.Seek(0) || !file.WriteObject(MakeHeader(version, data_end))) {
+        LOG_ERROR(Common_Filesystem, "Failed to write pipeline cache index");
+        return;
+    }
+    index_dirty = false;
+    appends_since_flush = 0;
+}
+
+std::optional<u64> PipelineCacheFile::Compact(const std::filesystem::path& filename,
+                                              u32 cache_version, std::span<const u8> data,
+                                              std::vector<IndexEntry>& entries) {
+    auto temp_filename{filename};
+    temp_filename += ".tmp";
+
+    std::vector<IndexEntry> compacted{entries};
+    u64 offset{sizeof(FileHeader)};
+    {
+        Common::FS::IOFile file(temp_filename, Common::FS::FileAccessMode::Write,
+                                Common::FS::FileType::BinaryFile);
+        bool written{file.IsOpen() && file.WriteObject(MakeHeader(cache_version, 0))};
+        for (IndexEntry& entry : compacted) {
+            if (!written) {
+                break;
+            }
+            const auto record{
+                data.subspan(entry.offset, sizeof(RecordHeader) + entry.compressed_size)};
+            written = file.WriteSpan(record) == record.size();
+            entry.offset = offset;
+            offset += record.size();
+        }
+        if (!written) {
+            file.Close();
+            Common::FS::RemoveFile(temp_filename);
+            LOG_ERROR(Common_Filesystem, "Failed to compact pipeline cache {}",
+                      Common::FS::PathToUTF8String(filename));
+            return std::nullopt;
+        }
+    }
+    if (!Common::FS::RemoveFile(filename) || !Common::FS::RenameFile(temp_filename, filename)) {
+        LOG_ERROR(Common_Filesystem, "Failed to replace pipeline cache {}",
+                  Common::FS::PathToUTF8String(filename));
+        return std::nullopt;
+    }
+    LOG_INFO(Common_Filesystem, "Compacted pipeline cache {} from {} to {} bytes",
+             Common::FS::PathToUTF8String(filename), data.size(), offset);
+    entries = std::move(compacted);
+    return offset;
+}
+
+bool PipelineCacheFile::MigrateImpl(const std::filesystem::path& filename, u32 cache_version,
+                                    size_t compute_key_size, size_t graphics_key_size) try {
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.exceptions(std::ifstream::failbit);
+    const auto end{file.tellg()};
+    file.seekg(0, std::ios::beg);
+
+    std::array<char, 8> magic_number;
+    u32 legacy_version;
+    file.read(magic_number.data(), magic_number.size())
+        .read(reinterpret_cast<char*>(&legacy_version), sizeof(legacy_version));
+    if (magic_number != LEGACY_MAGIC_NUMBER || legacy_version != cache_version) {
+        return false;
+    }
+    auto temp_filename{filename};
+    temp_filename += ".tmp";
+
+    size_t num_pipelines{};
+    {
+        PipelineCacheFile container;
+        container.Reset(temp_filename, cache_version);
+        while (file.tellg() != end) {
+            u32 num_envs{};
+            file.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
+            std::vector<FileEnvironment> envs(num_envs);
+            for (FileEnvironment& env : envs) {
+                env.Deserialize(file);
+            }
+            const bool is_compute{envs.front().ShaderStage() == Shader::Stage::Compute};
+            std::vector<char> key(is_compute ? compute_key_size : graphics_key_size);
+            file.read(key.data(), key.size());
+
+            std::vector<SerializedEnvironment> serialized;
+            serialized.reserve(envs.size());
+            for (const FileEnvironment& env : envs) {
+                serialized.push_back(Serialize(env));
+            }
+            container.AppendImpl(key, serialized);
+            ++num_pipelines;
+        }
+        if (container.path.empty()) {
+            return false;
+        }
+    }
+    file.close();
+    if (!Common::FS::RemoveFile(filename) || !Common::FS::RenameFile(temp_filename, filename)) {
+        LOG_ERROR(Common_Filesystem, "Failed to replace legacy pipeline cache {}",
+                  Common::FS::PathToUTF8String(filename));
+        return false;
+    }
+    LOG_INFO(Common_Filesystem, "Migrated {} pipelines from legacy pipeline cache {}",
+             num_pipelines, Common::FS::PathToUTF8String(filename));
+    return true;
+
+} catch (const std::ios_base::failure& e) {
+    LOG_ERROR(Common_Filesystem, "Failed to migrate legacy pipeline cache: {}", e.what());
+    return false;
+}
+
+} // namespace VideoCommon
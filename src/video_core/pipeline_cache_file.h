@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/polyfill_thread.h"
+#include "common/unique_function.h"
+#include "video_core/shader_environment.h"
+
+namespace VideoCommon {
+
+/**
+ * Transferable pipeline cache stored as a chunked container.
+ *
+ * The file starts with a header pointing at an index of every record. Records are individually
+ * zstd compressed and checksummed, so a damaged record only drops that pipeline. Shader code is
+ * stored in content-addressed blobs shared by every pipeline that uses the same program. New
+ * pipelines are appended after the existing records and the index is rewritten periodically; a
+ * missing or stale index is rebuilt by scanning the records. Each key is stored once, and loading
+ * rewrites the file without damaged, duplicate or unreferenced records when it finds any.
+ *
+ * Keys and environments are stored as raw backend structs, so a file written with another cache
+ * version is discarded instead of converted.
+ */
+class PipelineCacheFile {
+public:
+    template <typename Key>
+    using ComputeLoader = Common::UniqueFunction<void, const Key&, FileEnvironment>;
+
+    template <typename Key>
+    using GraphicsLoader = Common::UniqueFunction<void, const Key&, std::vector<FileEnvironment>>;
+
+    explicit PipelineCacheFile() = default;
+    ~PipelineCacheFile();
+
+    PipelineCacheFile& operator=(const PipelineCacheFile&) = delete;
+    PipelineCacheFile(const PipelineCacheFile&) = delete;
+
+    /// Loads every pipeline stored in the file and keeps it open for appending new pipelines.
+    /// Legacy raw pipeline streams are converted to the container format first.
+    template <typename ComputeKey, typename GraphicsKey>
+    void Load(std::stop_token stop_loading, const std::filesystem::path& filename,
+              u32 cache_version, ComputeLoader<ComputeKey> load_compute,
+              GraphicsLoader<GraphicsKey> load_graphics) {
+        static_assert(std::is_trivially_copyable_v<ComputeKey>);
+        static_assert(std::is_trivially_copyable_v<GraphicsKey>);
+        LoadImpl(
+            stop_loading, filename, cache_version, sizeof(ComputeKey), sizeof(GraphicsKey),
+            [&](std::span<const char> key_data, FileEnvironment env) {
+                ComputeKey key;
+                std::memcpy(&key, key_data.data(), sizeof(key));
+                load_compute(key, std::move(env));
+            },
+            [&](std::span<const char> key_data, std::vector<FileEnvironment> envs) {
+                GraphicsKey key;
+                std::memcpy(&key, key_data.data(), sizeof(key));
+                load_graphics(key, std::move(envs));
+            });
+    }
+
+    /// Appends a pipeline to the file opened by Load. Does nothing when no file is open.
+    template <typename Key, typename Envs>
+    void Append(const Key& key, const Envs& envs) {
+        static_assert(std::is_trivially_copyable_v<Key>);
+        static_assert(std::has_unique_object_representations_v<Key>);
+        std::vector<SerializedEnvironment> serialized;
+        serialized.reserve(envs.size());
+        for (const auto* const env : envs) {
+            if constexpr (std::is_base_of_v<GenericEnvironment,
+                                            std::remove_cvref_t<decltype(*env)>>) {
+                if (!env->CanBeSerialized()) {
+                    return;
+                }
+            }
+            serialized.push_back(Serialize(*env));
+        }
+        AppendImpl(std::span(reinterpret_cast<const char*>(&key), sizeof(key)), serialized);
+    }
+
+    /// Writes the index of the open file, if it has changed since it was last written.
+    void Flush();
+
+    /// Converts a legacy raw pipeline stream to the container format in place.
+    /// Returns true when a legacy stream was converted.
+    template <typename ComputeKey, typename GraphicsKey>
+    static bool Migrate(const std::filesystem::path& filename, u32 cache_version) {
+        return MigrateImpl(filename, cache_version, sizeof(ComputeKey), sizeof(GraphicsKey));
+    }
+
+private:
+    struct SerializedEnvironment {
+        std::string metadata;
+        std::span<const u8> code;
+    };
+
+    struct IndexEntry {
+        u64 offset;
+        u32 type;
+        u32 compressed_size;
+        u32 uncompressed_size;
+        u32 reserved;
+        u64 hash;
+        u64 checksum;
+    };
+
+    using RawComputeLoader = Common::UniqueFunction<void, std::span<const char>, FileEnvironment>;
+    using RawGraphicsLoader =
+        Common::UniqueFunction<void, std::span<const char>, std::vector<FileEnvironment>>;
+
+    static SerializedEnvironment Serialize(const GenericEnvironment& env);
+
+    static SerializedEnvironment Serialize(const FileEnvironment& env);
+
+    void LoadImpl(std::stop_token stop_loading, const std::filesystem::path& filename,
+                  u32 cache_version, size_t compute_key_size, size_t graphics_key_size,
+                  RawComputeLoader load_compute, RawGraphicsLoader load_graphics);
+
+    void AppendImpl(std::span<const char> key, std::span<const SerializedEnvironment> envs);
+
+    void AppendLocked(std::span<const char> key, std::span<const SerializedEnvironment> envs);
+
+    void FlushLocked();
+
+    void Reset(const std::filesystem::path& filename, u32 cache_version);
+
+    /// Rewrites the file with only the given records, updating their offsets.
+    /// Returns the end of the records, or nullopt when the file was left untouched.
+    static std::optional<u64> Compact(const std::filesystem::path& filename, u32 cache_version,
+                                      std::span<const u8> data, std::vector<IndexEntry>& entries);
+
+    static bool MigrateImpl(const std::filesystem::path& filename, u32 cache_version,
+                            size_t compute_key_size, size_t graphics_key_size);
+
+    std::mutex mutex;
+    std::filesystem::path path;
+    u32 version{};
+    std::vector<IndexEntry> index;
+    std::unordered_set<u64> stored_blobs;
+    std::unordered_set<u64> stored_pipelines;
+    u64 data_end{};
+    bool index_dirty{};
+    size_t appends_since_flush{};
+};
+
+} // namespace VideoCommon
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "video_core/pipeline_usage.h"
+
+namespace VideoCommon {
+namespace {
+constexpr std::array<char, 8> USAGE_MAGIC_NUMBER{'c', 't', 'r', 'n', 'u', 's', 'e', 'd'};
+constexpr u32 USAGE_VERSION = 1;
+
+/// Number of previous sessions whose pipelines are built before the game is allowed to start.
+constexpr u32 HOT_SESSION_WINDOW = 2;
+
+/// Records that have not been touched in this many sessions are dropped when saving.
+constexpr u32 MAX_SESSION_AGE = 64;
+
+struct UsageHeader {
+    std::array<char, 8> magic;
+    u32 version;
+    u32 session;
+    u64 num_entries;
+};
+static_assert(sizeof(UsageHeader) == 24);
+
+struct UsageEntry {
+    u64 key_hash;
+    u32 session;
+    u32 padding;
+};
+static_assert(sizeof(UsageEntry) == 16);
+} // Anonymous namespace
+
+void PipelineUsage::Load(const std::filesystem::path& filename_) {
+    filename = filename_;
+    last_used.clear();
+    session = 1;
+
+    Common::FS::IOFile file(filename, Common::FS::FileAccessMode::Read,
+                            Common::FS::FileType::BinaryFile);
+    if (!file.IsOpen()) {
+        return;
+    }
+    UsageHeader header{};
+    if (!file.ReadObject(header) || header.magic != USAGE_MAGIC_NUMBER ||
+        header.version != USAGE_VERSION) {
+        LOG_INFO(Render, "Discarding invalid pipeline usage file");
+        return;
+    }
+    std::vector<UsageEntry> entries(header.num_entries);
+    if (file.ReadSpan(std::span(entries)) != entries.size()) {
+        LOG_ERROR(Render, "Pipeline usage file is truncated");
+        return;
+    }
+    last_used.reserve(entries.size());
+    for (const UsageEntry& entry : entries) {
+        last_used.emplace(entry.key_hash, entry.session);
+    }
+    session = header.session + 1;
+}
+
+void PipelineUsage::Save() const {
+    if (filename.empty()) {
+        return;
+    }
+    std::vector<UsageEntry> entries;
+    entries.reserve(last_used.size());
+    for (const auto& [key_hash, entry_session] : last_used) {
+        if (session - entry_session < MAX_SESSION_AGE) {
+            entries.push_back(UsageEntry{
+                .key_hash = key_hash,
+                .session = entry_session,
+                .padding = 0,
+            });
+        }
+    }
+    const UsageHeader header{
+        .magic = USAGE_MAGIC_NUMBER,
+        .version = USAGE_VERSION,
+        .session = session,
+        .num_entries = entries.size(),
+    };
+    Common::FS::IOFile file(filename, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::BinaryFile);
+    if (!file.IsOpen() || !file.WriteObject(header) ||
+        file.WriteSpan(std::span<const UsageEntry>(entries)) != entries.size()) {
+        LOG_ERROR(Render, "Failed to write pipeline usage file {}",
+                  Common::FS::PathToUTF8String(filename));
+    }
+}
+
+bool PipelineUsage::IsHot(u32 last_used_session) const noexcept {
+    if (!HasHistory()) {
+        // Without history every pipeline is treated as hot, matching the old blocking behavior
+        return true;
+    }
+    return last_used_session != 0 && session - last_used_session <= HOT_SESSION_WINDOW;
+}
+
+} // namespace VideoCommon
@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <unordered_map>
+
+#include "common/common_types.h"
+
+namespace VideoCommon {
+
+/// Records the boot session in which each pipeline stored in the disk cache was last used, so
+/// the cache can be warmed up in most-recently-used order on the next boot.
+class PipelineUsage {
+public:
+    /// Loads the usage records from disk and starts a new session.
+    void Load(const std::filesystem::path& filename);
+
+    /// Writes the usage records back to the file they were loaded from.
+    void Save() const;
+
+    /// Marks the pipeline with the given key hash as used in the current session.
+    void MarkUsed(u64 key_hash) {
+        if (!filename.empty()) {
+            last_used.insert_or_assign(key_hash, session);
+        }
+    }
+
+    /// Returns the session the pipeline was last used in, or zero if it has never been used.
+    [[nodiscard]] u32 LastUsed(u64 key_hash) const noexcept {
+        const auto it{last_used.find(key_hash)};
+        return it != last_used.end() ? it->second : 0;
+    }
+
+    /// Returns true when a pipeline belongs to the set that was used in recent sessions.
+    [[nodiscard]] bool IsHot(u32 last_used_session) const noexcept;
+
+    /// Returns true when there are usage records from previous sessions.
+    [[nodiscard]] bool HasHistory() const noexcept {
+        return session > 1 && !last_used.empty();
+    }
+
+private:
+    std::filesystem::path filename;
+    std::unordered_map<u64, u32> last_used;
+    u32 session{};
+};
+
+} // namespace VideoCommon
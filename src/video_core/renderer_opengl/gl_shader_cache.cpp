@@ -47,8 +47,6 @@ using VideoCommon::ComputeEnvironment;
 using VideoCommon::FileEnvironment;
 using VideoCommon::GenericEnvironment;
 using VideoCommon::GraphicsEnvironment;
-using VideoCommon::LoadPipelines;
-using VideoCommon::SerializePipeline;
 using Context = ShaderContext::Context;
 
 constexpr u32 CACHE_VERSION = 10;
@@ -290,9 +288,7 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
             workers->QueueWork(std::move(work));
         }
     }};
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
-        ComputePipelineKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
+    const auto load_compute{[&](const ComputePipelineKey& key, FileEnvironment env) {
         queue_work([this, key, env_ = std::move(env), &state, &callback](Context* ctx) mutable {
             ctx->pools.ReleaseContents();
             auto pipeline{CreateComputePipeline(ctx->pools, key, env_, true)};
@@ -307,9 +303,8 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         });
         ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
-        GraphicsPipelineKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
+    const auto load_graphics{[&](const GraphicsPipelineKey& key,
+                                 std::vector<FileEnvironment> envs) {
         queue_work([this, key, envs_ = std::move(envs), &state, &callback](Context* ctx) mutable {
             boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
             for (auto& env : envs_) {
@@ -328,7 +323,8 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         });
         ++state.total;
     }};
-    LoadPipelines(stop_loading, shader_cache_filename, CACHE_VERSION, load_compute, load_graphics);
+    pipeline_cache_file.Load<ComputePipelineKey, GraphicsPipelineKey>(
+        stop_loading, shader_cache_filename, CACHE_VERSION, load_compute, load_graphics);
 
     LOG_INFO(Render_OpenGL, "Total Pipeline Count: {}", state.total);
 
@@ -346,6 +342,12 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
     }
 }
 
+bool ShaderCache::MigrateDiskCache(const std::filesystem::path& filename) {
+    using VideoCommon::PipelineCacheFile;
+    return PipelineCacheFile::Migrate<ComputePipelineKey, GraphicsPipelineKey>(filename,
+                                                                              CACHE_VERSION);
+}
+
 GraphicsPipeline* ShaderCache::CurrentGraphicsPipeline() {
     if (!RefreshStages(graphics_key.unique_hashes)) {
         current_pipeline = nullptr;
@@ -442,7 +444,7 @@ std::unique_ptr<GraphicsPipeline> ShaderCache::CreateGraphicsPipeline() {
             env_ptrs.push_back(&environments.envs[index]);
         }
     }
-    SerializePipeline(graphics_key, env_ptrs, shader_cache_filename, CACHE_VERSION);
+    pipeline_cache_file.Append(graphics_key, env_ptrs);
     return pipeline;
 }
 
@@ -564,8 +566,7 @@ std::unique_ptr<ComputePipeline> ShaderCache::CreateComputePipeline(
     if (!pipeline || shader_cache_filename.empty()) {
         return pipeline;
     }
-    SerializePipeline(key, std::array<const GenericEnvironment*, 1>{&env}, shader_cache_filename,
-                      CACHE_VERSION);
+    pipeline_cache_file.Append(key, std::array<const GenericEnvironment*, 1>{&env});
     return pipeline;
 }
 
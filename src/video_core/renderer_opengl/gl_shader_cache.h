@@ -12,6 +12,7 @@
 #include "shader_recompiler/profile.h"
 #include "video_core/renderer_opengl/gl_compute_pipeline.h"
 #include "video_core/renderer_opengl/gl_graphics_pipeline.h"
+#include "video_core/pipeline_cache_file.h"
 #include "video_core/renderer_opengl/gl_shader_context.h"
 #include "video_core/shader_cache.h"
 
@@ -38,6 +39,9 @@ public:
     void LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                            const VideoCore::DiskResourceLoadCallback& callback);
 
+    /// Converts a legacy transferable shader cache to the container format in place.
+    static bool MigrateDiskCache(const std::filesystem::path& filename);
+
     [[nodiscard]] GraphicsPipeline* CurrentGraphicsPipeline();
 
     [[nodiscard]] ComputePipeline* CurrentComputePipeline();
@@ -85,6 +89,7 @@ private:
     Shader::HostTranslateInfo host_info;
 
     std::filesystem::path shader_cache_filename;
+    VideoCommon::PipelineCacheFile pipeline_cache_file;
     std::unique_ptr<ShaderWorker> workers;
 };
 
@@ -44,9 +44,13 @@ StagingBufferMap StagingBuffers::RequestMap(size_t requested_size, bool insert_f
     };
 }
 
-void StagingBuffers::FreeDeferredStagingBuffer(size_t index) {
+void StagingBuffers::FreeDeferredStagingBuffer(size_t index, bool insert_fence) {
     ASSERT(allocs[index].deferred);
     allocs[index].deferred = false;
+    if (insert_fence) {
+        allocs[index].sync_index = ++current_sync_index;
+        allocs[index].sync.Create();
+    }
 }
 
 size_t StagingBuffers::RequestBuffer(size_t requested_size) {
@@ -145,8 +149,9 @@ std::pair<std::span<u8>, size_t> StreamBuffer::Request(size_t size) noexcept {
     return {std::span(mapped_pointer + offset, size), offset};
 }
 
-StagingBufferMap StagingBufferPool::RequestUploadBuffer(size_t size) {
-    return upload_buffers.RequestMap(size, true);
+StagingBufferMap StagingBufferPool::RequestUploadBuffer(size_t size, bool deferred) {
+    // Deferred buffers are fenced when they are freed, after their last upload
+    return upload_buffers.RequestMap(size, !deferred, deferred);
 }
 
 StagingBufferMap StagingBufferPool::RequestDownloadBuffer(size_t size, bool deferred) {
@@ -157,4 +162,8 @@ void StagingBufferPool::FreeDeferredStagingBuffer(StagingBufferMap& buffer) {
     download_buffers.FreeDeferredStagingBuffer(buffer.index);
 }
 
+void StagingBufferPool::FreeDeferredUploadBuffer(StagingBufferMap& buffer) {
+    upload_buffers.FreeDeferredStagingBuffer(buffer.index, true);
+}
+
 } // namespace OpenGL
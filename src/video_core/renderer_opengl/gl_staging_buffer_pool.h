@@ -35,7 +35,7 @@ struct StagingBuffers {
 
     StagingBufferMap RequestMap(size_t requested_size, bool insert_fence, bool deferred = false);
 
-    void FreeDeferredStagingBuffer(size_t index);
+    void FreeDeferredStagingBuffer(size_t index, bool insert_fence = false);
 
     size_t RequestBuffer(size_t requested_size);
 
@@ -91,9 +91,10 @@ public:
     StagingBufferPool() = default;
     ~StagingBufferPool() = default;
 
-    StagingBufferMap RequestUploadBuffer(size_t size);
+    StagingBufferMap RequestUploadBuffer(size_t size, bool deferred = false);
     StagingBufferMap RequestDownloadBuffer(size_t size, bool deferred = false);
     void FreeDeferredStagingBuffer(StagingBufferMap& buffer);
+    void FreeDeferredUploadBuffer(StagingBufferMap& buffer);
 
 private:
     StagingBuffers upload_buffers{GL_MAP_WRITE_BIT, GL_MAP_WRITE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT};
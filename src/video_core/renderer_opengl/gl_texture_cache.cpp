@@ -553,8 +553,8 @@ void TextureCacheRuntime::Finish() {
     glFinish();
 }
 
-StagingBufferMap TextureCacheRuntime::UploadStagingBuffer(size_t size) {
-    return staging_buffer_pool.RequestUploadBuffer(size);
+StagingBufferMap TextureCacheRuntime::UploadStagingBuffer(size_t size, bool deferred) {
+    return staging_buffer_pool.RequestUploadBuffer(size, deferred);
 }
 
 StagingBufferMap TextureCacheRuntime::DownloadStagingBuffer(size_t size, bool deferred) {
@@ -565,6 +565,10 @@ void TextureCacheRuntime::FreeDeferredStagingBuffer(StagingBufferMap& buffer) {
     staging_buffer_pool.FreeDeferredStagingBuffer(buffer);
 }
 
+void TextureCacheRuntime::FreeDeferredUploadStagingBuffer(StagingBufferMap& buffer) {
+    staging_buffer_pool.FreeDeferredUploadBuffer(buffer);
+}
+
 u64 TextureCacheRuntime::GetDeviceMemoryUsage() const {
     if (device.CanReportMemoryUsage()) {
         return device_access_memory - device.GetCurrentDedicatedVideoMemory();
@@ -72,12 +72,14 @@ public:
 
     void Finish();
 
-    StagingBufferMap UploadStagingBuffer(size_t size);
+    StagingBufferMap UploadStagingBuffer(size_t size, bool deferred = false);
 
     StagingBufferMap DownloadStagingBuffer(size_t size, bool deferred = false);
 
     void FreeDeferredStagingBuffer(StagingBufferMap& buffer);
 
+    void FreeDeferredUploadStagingBuffer(StagingBufferMap& buffer);
+
     u64 GetDeviceLocalMemory() const {
         return device_access_memory;
     }
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <fstream>
+#include <functional>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -310,9 +311,15 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
       texture_cache{texture_cache_}, shader_notify{shader_notify_},
       use_asynchronous_shaders{Settings::values.use_asynchronous_shaders.GetValue()},
       use_vulkan_pipeline_cache{Settings::values.use_vulkan_driver_pipeline_cache.GetValue()},
+      use_background_pipeline_loading{
+          Settings::values.use_background_pipeline_loading.GetValue()},
       workers(device.HasBrokenParallelShaderCompiling() ? 1ULL : GetTotalPipelineWorkers(),
               "VkPipelineBuilder"),
-      serialization_thread(1, "VkPipelineSerialization") {
+      serialization_thread(1, "VkPipelineSerialization"),
+      background_workers(device.HasBrokenParallelShaderCompiling()
+                             ? 1ULL
+                             : std::max<size_t>(GetTotalPipelineWorkers() / 2, 1ULL),
+                         "VkPipelineWarmup") {
     const auto& float_control{device.FloatControlProperties()};
     const VkDriverId driver_id{device.GetDriverID()};
     profile = Shader::Profile{
@@ -412,6 +419,7 @@ PipelineCache::PipelineCache(Tegra::MaxwellDeviceMemoryManager& device_memory_,
 }
 
 PipelineCache::~PipelineCache() {
+    pipeline_usage.Save();
     if (use_vulkan_pipeline_cache && !vulkan_pipeline_cache_filename.empty()) {
         SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
                                      CACHE_VERSION);
@@ -450,12 +458,19 @@ ComputePipeline* PipelineCache::CurrentComputePipeline() {
         .shared_memory_size = qmd.shared_alloc,
         .workgroup_size{qmd.block_dim_x, qmd.block_dim_y, qmd.block_dim_z},
     };
+    if (has_background_pipelines.load(std::memory_order_acquire)) {
+        MergeBackgroundPipelines();
+    }
+    pipeline_usage.MarkUsed(key.Hash());
     const auto [pair, is_new]{compute_cache.try_emplace(key)};
     auto& pipeline{pair->second};
     if (!is_new) {
         return pipeline.get();
     }
-    pipeline = CreateComputePipeline(key, shader);
+    pipeline = TakeBackgroundBuild(pending_compute, background_compute, key);
+    if (!pipeline) {
+        pipeline = CreateComputePipeline(key, shader);
+    }
     return pipeline.get();
 }
 
@@ -478,39 +493,63 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
             LoadVulkanPipelineCache(vulkan_pipeline_cache_filename, CACHE_VERSION);
     }
 
-    struct {
+    pipeline_usage.Load(base_dir / "vulkan_usage.bin");
+
+    // Progress of the builds the game waits on before it starts.
+    struct HotBuildState {
         std::mutex mutex;
         size_t total{};
         size_t built{};
         bool has_loaded{};
         std::unique_ptr<PipelineStatistics> statistics;
-    } state;
+        const VideoCore::DiskResourceLoadCallback& callback;
+
+        void FinishBuild() {
+            std::scoped_lock lock{mutex};
+            ++built;
+            if (has_loaded) {
+                callback(VideoCore::LoadCallbackStage::Build, built, total);
+            }
+        }
+    } state{.callback = callback};
+
+    // Pipelines are queued once the whole file has been read, so the ones used in the most recent
+    // sessions are compiled first. Builders the game waits on are given the progress state, the
+    // background ones may run after this function returns and get a null pointer instead. Every
+    // pipeline is registered as pending, so the game can take over the builds it needs first.
+    struct PendingBuild {
+        u32 last_used;
+        Common::UniqueFunction<void, HotBuildState*> build;
+    };
+    std::vector<PendingBuild> pending;
 
     if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
         state.statistics = std::make_unique<PipelineStatistics>(device);
     }
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
-        ComputePipelineCacheKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
-
-        workers.QueueWork([this, key, env_ = std::move(env), &state, &callback]() mutable {
-            ShaderPools pools;
-            auto pipeline{CreateComputePipeline(pools, key, env_, state.statistics.get(), false)};
-            std::scoped_lock lock{state.mutex};
-            if (pipeline) {
-                compute_cache.emplace(key, std::move(pipeline));
-            }
-            ++state.built;
-            if (state.has_loaded) {
-                callback(VideoCore::LoadCallbackStage::Build, state.built, state.total);
-            }
+    const auto load_compute{[&](const ComputePipelineCacheKey& key, FileEnvironment env) {
+        disk_compute_keys.insert(key);
+        {
+            std::scoped_lock lock{background_mutex};
+            pending_compute.emplace(key, false);
+        }
+        pending.push_back(PendingBuild{
+            .last_used = pipeline_usage.LastUsed(key.Hash()),
+            .build = [this, key, env_ = std::move(env)](HotBuildState* hot) mutable {
+                if (BeginBackgroundBuild(pending_compute, key)) {
+                    ShaderPools pools;
+                    auto pipeline{CreateComputePipeline(
+                        pools, key, env_, hot ? hot->statistics.get() : nullptr, false)};
+                    FinishBackgroundBuild(pending_compute, background_compute, key,
+                                          std::move(pipeline));
+                }
+                if (hot) {
+                    hot->FinishBuild();
+                }
+            },
         });
-        ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
-        GraphicsPipelineCacheKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
-
+    const auto load_graphics{[&](const GraphicsPipelineCacheKey& key,
+                                 std::vector<FileEnvironment> envs) {
         if ((key.state.extended_dynamic_state != 0) !=
                 dynamic_features.has_extended_dynamic_state ||
             (key.state.extended_dynamic_state_2 != 0) !=
@@ -524,38 +563,66 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
             (key.state.dynamic_vertex_input != 0) != dynamic_features.has_dynamic_vertex_input) {
             return;
         }
-        workers.QueueWork([this, key, envs_ = std::move(envs), &state, &callback]() mutable {
-            ShaderPools pools;
-            boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
-            for (auto& env : envs_) {
-                env_ptrs.push_back(&env);
-            }
-            auto pipeline{CreateGraphicsPipeline(pools, key, MakeSpan(env_ptrs),
-                                                 state.statistics.get(), false)};
-
-            std::scoped_lock lock{state.mutex};
-            if (pipeline) {
-                graphics_cache.emplace(key, std::move(pipeline));
-            }
-            ++state.built;
-            if (state.has_loaded) {
-                callback(VideoCore::LoadCallbackStage::Build, state.built, state.total);
-            }
+        disk_graphics_keys.insert(key);
+        {
+            std::scoped_lock lock{background_mutex};
+            pending_graphics.emplace(key, false);
+        }
+        pending.push_back(PendingBuild{
+            .last_used = pipeline_usage.LastUsed(key.Hash()),
+            .build = [this, key, envs_ = std::move(envs)](HotBuildState* hot) mutable {
+                if (BeginBackgroundBuild(pending_graphics, key)) {
+                    ShaderPools pools;
+                    boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
+                    for (auto& env : envs_) {
+                        env_ptrs.push_back(&env);
+                    }
+                    auto pipeline{CreateGraphicsPipeline(pools, key, MakeSpan(env_ptrs),
+                                                         hot ? hot->statistics.get() : nullptr,
+                                                         false)};
+                    FinishBackgroundBuild(pending_graphics, background_graphics, key,
+                                          std::move(pipeline));
+                }
+                if (hot) {
+                    hot->FinishBuild();
+                }
+            },
         });
-        ++state.total;
     }};
-    VideoCommon::LoadPipelines(stop_loading, pipeline_cache_filename, CACHE_VERSION, load_compute,
-                               load_graphics);
-
-    LOG_INFO(Render_Vulkan, "Total Pipeline Count: {}", state.total);
+    pipeline_cache_file.Load<ComputePipelineCacheKey, GraphicsPipelineCacheKey>(
+        stop_loading, pipeline_cache_filename, CACHE_VERSION, load_compute, load_graphics);
+
+    std::ranges::stable_sort(pending, std::greater{}, &PendingBuild::last_used);
+    const auto cold_begin{use_background_pipeline_loading
+                              ? std::ranges::find_if_not(pending,
+                                                         [this](const PendingBuild& build) {
+                                                             return pipeline_usage.IsHot(
+                                                                 build.last_used);
+                                                         })
+                              : pending.end()};
+    const size_t num_hot{static_cast<size_t>(std::distance(pending.begin(), cold_begin))};
+    state.total = num_hot;
+
+    LOG_INFO(Render_Vulkan, "Total Pipeline Count: {} ({} deferred to background)",
+             pending.size(), pending.size() - num_hot);
 
     std::unique_lock lock{state.mutex};
     callback(VideoCore::LoadCallbackStage::Build, 0, state.total);
     state.has_loaded = true;
     lock.unlock();
 
+    for (auto it = pending.begin(); it != cold_begin; ++it) {
+        workers.QueueWork([build = std::move(it->build), &state]() mutable { build(&state); });
+    }
     workers.WaitForRequests(stop_loading);
 
+    if (!stop_loading.stop_requested()) {
+        for (auto it = cold_begin; it != pending.end(); ++it) {
+            background_workers.QueueWork(
+                [build = std::move(it->build)]() mutable { build(nullptr); });
+        }
+    }
+
     if (use_vulkan_pipeline_cache) {
         SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
                                      CACHE_VERSION);
@@ -566,15 +633,92 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     }
 }
 
+void PipelineCache::MergeBackgroundPipelines() {
+    std::scoped_lock lock{background_mutex};
+    for (auto& [key, pipeline] : background_compute) {
+        // Pipelines the game requested before the background build finished are kept as they are
+        compute_cache.try_emplace(key, std::move(pipeline));
+    }
+    for (auto& [key, pipeline] : background_graphics) {
+        graphics_cache.try_emplace(key, std::move(pipeline));
+    }
+    background_compute.clear();
+    background_graphics.clear();
+    has_background_pipelines.store(false, std::memory_order_relaxed);
+}
+
+template <typename Key>
+bool PipelineCache::BeginBackgroundBuild(std::unordered_map<Key, bool>& builds, const Key& key) {
+    std::scoped_lock lock{background_mutex};
+    const auto it{builds.find(key)};
+    if (it == builds.end() || it->second) {
+        return false;
+    }
+    it->second = true;
+    return true;
+}
+
+template <typename Key, typename Pipeline>
+void PipelineCache::FinishBackgroundBuild(
+    std::unordered_map<Key, bool>& builds,
+    std::vector<std::pair<Key, std::unique_ptr<Pipeline>>>& results, const Key& key,
+    std::unique_ptr<Pipeline> pipeline) {
+    {
+        std::scoped_lock lock{background_mutex};
+        if (pipeline) {
+            results.emplace_back(key, std::move(pipeline));
+            has_background_pipelines.store(true, std::memory_order_release);
+        }
+        builds.erase(key);
+    }
+    background_cv.notify_all();
+}
+
+template <typename Key, typename Pipeline>
+std::unique_ptr<Pipeline> PipelineCache::TakeBackgroundBuild(
+    std::unordered_map<Key, bool>& builds,
+    std::vector<std::pair<Key, std::unique_ptr<Pipeline>>>& results, const Key& key) {
+    std::unique_lock lock{background_mutex};
+    if (const auto it{builds.find(key)}; it != builds.end()) {
+        if (!it->second) {
+            // Not started yet, the caller builds it and the worker skips it.
+            builds.erase(it);
+            return nullptr;
+        }
+        background_cv.wait(lock, [&] { return !builds.contains(key); });
+    }
+    const auto it{
+        std::ranges::find_if(results, [&](const auto& result) { return result.first == key; })};
+    if (it == results.end()) {
+        return nullptr;
+    }
+    auto pipeline{std::move(it->second)};
+    results.erase(it);
+    return pipeline;
+}
+
+bool PipelineCache::MigrateDiskCache(const std::filesystem::path& filename) {
+    using VideoCommon::PipelineCacheFile;
+    return PipelineCacheFile::Migrate<ComputePipelineCacheKey, GraphicsPipelineCacheKey>(
+        filename, CACHE_VERSION);
+}
+
 GraphicsPipeline* PipelineCache::CurrentGraphicsPipelineSlowPath() {
+    if (has_background_pipelines.load(std::memory_order_acquire)) {
+        MergeBackgroundPipelines();
+    }
     const auto [pair, is_new]{graphics_cache.try_emplace(graphics_key)};
     auto& pipeline{pair->second};
     if (is_new) {
-        pipeline = CreateGraphicsPipeline();
+        pipeline = TakeBackgroundBuild(pending_graphics, background_graphics, graphics_key);
+        if (!pipeline) {
+            pipeline = CreateGraphicsPipeline();
+        }
     }
     if (!pipeline) {
         return nullptr;
     }
+    pipeline_usage.MarkUsed(graphics_key.Hash());
     if (current_pipeline) {
         current_pipeline->AddTransition(pipeline.get());
     }
@@ -713,7 +857,7 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline() {
     main_pools.ReleaseContents();
     auto pipeline{
         CreateGraphicsPipeline(main_pools, graphics_key, environments.Span(), nullptr, true)};
-    if (!pipeline || pipeline_cache_filename.empty()) {
+    if (!pipeline || pipeline_cache_filename.empty() || disk_graphics_keys.contains(graphics_key)) {
         return pipeline;
     }
     serialization_thread.QueueWork([this, key = graphics_key, envs = std::move(environments.envs)] {
@@ -724,7 +868,7 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline() {
                 env_ptrs.push_back(&envs[index]);
             }
         }
-        SerializePipeline(key, env_ptrs, pipeline_cache_filename, CACHE_VERSION);
+        pipeline_cache_file.Append(key, env_ptrs);
     });
     return pipeline;
 }
@@ -738,12 +882,11 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
 
     main_pools.ReleaseContents();
     auto pipeline{CreateComputePipeline(main_pools, key, env, nullptr, true)};
-    if (!pipeline || pipeline_cache_filename.empty()) {
+    if (!pipeline || pipeline_cache_filename.empty() || disk_compute_keys.contains(key)) {
         return pipeline;
     }
     serialization_thread.QueueWork([this, key, env_ = std::move(env)] {
-        SerializePipeline(key, std::array<const GenericEnvironment*, 1>{&env_},
-                          pipeline_cache_filename, CACHE_VERSION);
+        pipeline_cache_file.Append(key, std::array<const GenericEnvironment*, 1>{&env_});
     });
     return pipeline;
 }
@@ -4,11 +4,15 @@
 #pragma once
 
 #include <array>
+#include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "common/common_types.h"
@@ -26,6 +30,8 @@
 #include "video_core/renderer_vulkan/vk_compute_pipeline.h"
 #include "video_core/renderer_vulkan/vk_graphics_pipeline.h"
 #include "video_core/renderer_vulkan/vk_texture_cache.h"
+#include "video_core/pipeline_cache_file.h"
+#include "video_core/pipeline_usage.h"
 #include "video_core/shader_cache.h"
 
 namespace Core {
@@ -113,11 +119,35 @@ public:
     void LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                            const VideoCore::DiskResourceLoadCallback& callback);
 
+    /// Converts a legacy transferable pipeline cache to the container format in place.
+    static bool MigrateDiskCache(const std::filesystem::path& filename);
+
 private:
     [[nodiscard]] GraphicsPipeline* CurrentGraphicsPipelineSlowPath();
 
     [[nodiscard]] GraphicsPipeline* BuiltPipeline(GraphicsPipeline* pipeline) const noexcept;
 
+    /// Moves pipelines built by the background loader into the caches
+    void MergeBackgroundPipelines();
+
+    /// Marks a queued build as started. Returns false if the game took it over, or if another
+    /// worker builds the same pipeline.
+    template <typename Key>
+    bool BeginBackgroundBuild(std::unordered_map<Key, bool>& builds, const Key& key);
+
+    /// Publishes the result of a background build, and wakes up the game if it waits for it.
+    template <typename Key, typename Pipeline>
+    void FinishBackgroundBuild(std::unordered_map<Key, bool>& builds,
+                               std::vector<std::pair<Key, std::unique_ptr<Pipeline>>>& results,
+                               const Key& key, std::unique_ptr<Pipeline> pipeline);
+
+    /// Takes over the background build of a pipeline the game needs now. Waits for the build if a
+    /// background worker already started it. Returns nullptr when the caller has to build it.
+    template <typename Key, typename Pipeline>
+    std::unique_ptr<Pipeline> TakeBackgroundBuild(
+        std::unordered_map<Key, bool>& builds,
+        std::vector<std::pair<Key, std::unique_ptr<Pipeline>>>& results, const Key& key);
+
     std::unique_ptr<GraphicsPipeline> CreateGraphicsPipeline();
 
     std::unique_ptr<GraphicsPipeline> CreateGraphicsPipeline(
@@ -150,6 +180,7 @@ private:
     VideoCore::ShaderNotify& shader_notify;
     bool use_asynchronous_shaders{};
     bool use_vulkan_pipeline_cache{};
+    bool use_background_pipeline_loading{};
 
     GraphicsPipelineCacheKey graphics_key{};
     GraphicsPipeline* current_pipeline{};
@@ -163,12 +194,31 @@ private:
     Shader::HostTranslateInfo host_info;
 
     std::filesystem::path pipeline_cache_filename;
+    VideoCommon::PipelineCacheFile pipeline_cache_file;
 
     std::filesystem::path vulkan_pipeline_cache_filename;
     vk::PipelineCache vulkan_pipeline_cache;
 
+    VideoCommon::PipelineUsage pipeline_usage;
+
+    std::mutex background_mutex;
+    std::atomic_bool has_background_pipelines{};
+    std::vector<std::pair<ComputePipelineCacheKey, std::unique_ptr<ComputePipeline>>>
+        background_compute;
+    std::vector<std::pair<GraphicsPipelineCacheKey, std::unique_ptr<GraphicsPipeline>>>
+        background_graphics;
+    /// Background builds that did not finish, mapped to whether a worker started them
+    std::unordered_map<ComputePipelineCacheKey, bool> pending_compute;
+    std::unordered_map<GraphicsPipelineCacheKey, bool> pending_graphics;
+    std::condition_variable background_cv;
+
+    /// Pipelines read from the disk cache, which are not appended to it again
+    std::unordered_set<ComputePipelineCacheKey> disk_compute_keys;
+    std::unordered_set<GraphicsPipelineCacheKey> disk_graphics_keys;
+
     Common::ThreadWorker workers;
     Common::ThreadWorker serialization_thread;
+    Common::ThreadWorker background_workers;
     DynamicFeatures dynamic_features;
 };
 
@@ -584,6 +584,16 @@ VideoCore::RasterizerDownloadArea RasterizerVulkan::GetFlushArea(DAddr addr, u64
             return *area;
         }
     }
+    {
+        std::scoped_lock lock{buffer_cache.mutex};
+        // Buffers are only left GPU modified after their fence when downloads are predicted
+        if (buffer_cache.UsesPredictiveDownloads()) {
+            auto area = buffer_cache.GetFlushArea(addr, size);
+            if (area) {
+                return *area;
+            }
+        }
+    }
     VideoCore::RasterizerDownloadArea new_area{
         .start_address = Common::AlignDown(addr, Core::DEVICE_PAGESIZE),
         .end_address = Common::AlignUp(addr + size, Core::DEVICE_PAGESIZE),
@@ -842,7 +852,10 @@ std::optional<FramebufferTextureInfo> RasterizerVulkan::AccelerateDisplay(
 
 void RasterizerVulkan::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
                                          const VideoCore::DiskResourceLoadCallback& callback) {
-    pipeline_cache.LoadDiskResources(title_id, stop_loading, callback);
+    if (Settings::values.use_disk_shader_cache.GetValue()) {
+        pipeline_cache.LoadDiskResources(title_id, stop_loading, callback);
+    }
+    texture_cache.LoadDiskResources(title_id);
 }
 
 void RasterizerVulkan::FlushWork() {
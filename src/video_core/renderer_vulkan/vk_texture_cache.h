@@ -49,12 +49,14 @@ public:
 
     void Finish();
 
-    StagingBufferRef UploadStagingBuffer(size_t size);
+    StagingBufferRef UploadStagingBuffer(size_t size, bool deferred = false);
 
     StagingBufferRef DownloadStagingBuffer(size_t size, bool deferred = false);
 
     void FreeDeferredStagingBuffer(StagingBufferRef& ref);
 
+    void FreeDeferredUploadStagingBuffer(StagingBufferRef& ref);
+
     void TickFrame();
 
     u64 GetDeviceLocalMemory() const;
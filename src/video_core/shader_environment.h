@@ -60,7 +60,11 @@ public:
 
     void Dump(u64 pipeline_hash, u64 shader_hash) override;
 
-    void Serialize(std::ofstream& file) const;
+    /// Returns the cached code that is stored alongside the serialized environment.
+    [[nodiscard]] std::span<const u8> CodeBytes() const noexcept;
+
+    /// Writes the environment state, excluding its code.
+    void Serialize(std::ostream& file) const;
 
     bool HasHLEMacroState() const override {
         return has_hle_engine_state;
@@ -165,7 +169,17 @@ public:
     FileEnvironment& operator=(const FileEnvironment&) = delete;
     FileEnvironment(const FileEnvironment&) = delete;
 
-    void Deserialize(std::ifstream& file);
+    /// Reads an environment in the legacy layout, with its code stored inline.
+    void Deserialize(std::istream& file);
+
+    /// Reads an environment whose code is stored in a separate blob.
+    void Deserialize(std::istream& file, std::span<const u8> code_bytes);
+
+    /// Returns the code that is stored alongside the serialized environment.
+    [[nodiscard]] std::span<const u8> CodeBytes() const noexcept;
+
+    /// Writes the environment state, excluding its code.
+    void Serialize(std::ostream& file) const;
 
     [[nodiscard]] u64 ReadInstruction(u32 address) override;
 
@@ -197,6 +211,8 @@ public:
     void Dump(u64 pipeline_hash, u64 shader_hash) override;
 
 private:
+    void DeserializeImpl(std::istream& file, std::optional<std::span<const u8>> code_bytes);
+
     std::vector<u64> code;
     std::unordered_map<u32, Shader::TextureType> texture_types;
     std::unordered_map<u32, Shader::TexturePixelFormat> texture_pixel_formats;
@@ -212,21 +228,4 @@ private:
     u32 viewport_transform_state = 1;
 };
 
-void SerializePipeline(std::span<const char> key, std::span<const GenericEnvironment* const> envs,
-                       const std::filesystem::path& filename, u32 cache_version);
-
-template <typename Key, typename Envs>
-void SerializePipeline(const Key& key, const Envs& envs, const std::filesystem::path& filename,
-                       u32 cache_version) {
-    static_assert(std::is_trivially_copyable_v<Key>);
-    static_assert(std::has_unique_object_representations_v<Key>);
-    SerializePipeline(std::span(reinterpret_cast<const char*>(&key), sizeof(key)),
-                      std::span(envs.data(), envs.size()), filename, cache_version);
-}
-
-void LoadPipelines(
-    std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
-    Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
-    Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics);
-
 } // namespace VideoCommon
@@ -11,6 +11,16 @@ class ShaderNotify {
 public:
     [[nodiscard]] int ShadersBuilding() noexcept;
 
+    /// Returns the number of shaders queued for building since boot.
+    [[nodiscard]] int ShadersQueued() const noexcept {
+        return num_building.load(std::memory_order_relaxed);
+    }
+
+    /// Returns the number of shaders that finished building since boot.
+    [[nodiscard]] int ShadersCompleted() const noexcept {
+        return num_complete.load(std::memory_order_relaxed);
+    }
+
     void MarkShaderComplete() noexcept {
         ++num_complete;
     }
@@ -0,0 +1,305 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <optional>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/fs/fs.h"
+#include "common/fs/fs_util.h"
+#include "common/fs/path_util.h"
+#include "common/literals.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "video_core/texture_cache/decoded_texture_cache.h"
+#include "video_core/texture_cache/image_info.h"
+
+namespace VideoCommon {
+namespace {
+using namespace Common::Literals;
+
+constexpr std::array<char, 8> MAGIC_NUMBER{'c', 'i', 't', 'r', 'o', 'n', 't', 'x'};
+constexpr u32 FORMAT_VERSION = 1;
+constexpr u32 RECORD_MAGIC = 0x43455254; // "TREC"
+
+/// Entries are no longer stored once the pack reaches this size
+constexpr u64 MAX_PACK_SIZE = 4_GiB;
+
+/// Upper bound of copies in a record, one per level and per layer of 3D slices at most
+constexpr u32 MAX_COPIES = 64;
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    u32 format_version;
+    u32 reserved;
+};
+static_assert(sizeof(FileHeader) == 16);
+
+struct RecordHeader {
+    u32 magic;
+    u32 num_copies;
+    u64 data_size;
+    u64 checksum; ///< Hash of the copies and the data
+    DecodedTextureKey key;
+};
+static_assert(sizeof(RecordHeader) == 80);
+static_assert(std::is_trivially_copyable_v<BufferImageCopy>);
+
+u64 Checksum(std::span<const BufferImageCopy> copies, std::span<const u8> data) {
+    const u64 copies_hash = Common::CityHash64(reinterpret_cast<const char*>(copies.data()),
+                                               copies.size_bytes());
+    return Common::CityHash64WithSeed(reinterpret_cast<const char*>(data.data()), data.size(),
+                                      copies_hash);
+}
+
+std::optional<RecordHeader> ReadRecordHeader(std::span<const u8> data, u64 offset) {
+    if (offset > data.size() || data.size() - offset < sizeof(RecordHeader)) {
+        return std::nullopt;
+    }
+    RecordHeader header;
+    std::memcpy(&header, data.data() + offset, sizeof(header));
+    if (header.magic != RECORD_MAGIC || header.num_copies == 0 ||
+        header.num_copies > MAX_COPIES) {
+        return std::nullopt;
+    }
+    const u64 remaining = data.size() - offset - sizeof(RecordHeader);
+    const u64 copies_size = header.num_copies * sizeof(BufferImageCopy);
+    if (remaining < copies_size || remaining - copies_size < header.data_size) {
+        return std::nullopt;
+    }
+    return header;
+}
+
+bool CreatePack(const std::filesystem::path& filename) {
+    Common::FS::IOFile file(filename, Common::FS::FileAccessMode::Write,
+                            Common::FS::FileType::BinaryFile);
+    const FileHeader header{
+        .magic = MAGIC_NUMBER,
+        .format_version = FORMAT_VERSION,
+        .reserved = 0,
+    };
+    return file.IsOpen() && file.WriteObject(header);
+}
+
+bool IsValidPack(std::span<const u8> data) {
+    if (data.size() < sizeof(FileHeader)) {
+        return false;
+    }
+    FileHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    return header.magic == MAGIC_NUMBER && header.format_version == FORMAT_VERSION;
+}
+} // Anonymous namespace
+
+DecodedTextureKey MakeDecodedTextureKey(const ImageInfo& info, std::span<const u8> guest_data) {
+    const bool is_linear = info.type == ImageType::Linear;
+    return DecodedTextureKey{
+        .data_hash = Common::CityHash64(reinterpret_cast<const char*>(guest_data.data()),
+                                        guest_data.size()),
+        .format = static_cast<u32>(info.format),
+        .type = static_cast<u32>(info.type),
+        .width = info.size.width,
+        .height = info.size.height,
+        .depth = info.size.depth,
+        .levels = static_cast<u32>(info.resources.levels),
+        .layers = static_cast<u32>(info.resources.layers),
+        .layout = is_linear ? info.pitch
+                            : (info.block.width | (info.block.height << 8) |
+                               (info.block.depth << 16)),
+        .layer_stride = info.layer_stride,
+        .tile_width_spacing = info.tile_width_spacing,
+        .target = static_cast<u32>(Settings::values.astc_recompression.GetValue()),
+        .reserved = 0,
+    };
+}
+
+size_t DecodedTextureCache::KeyHash::operator()(const DecodedTextureKey& key) const noexcept {
+    return static_cast<size_t>(
+        Common::CityHash64(reinterpret_cast<const char*>(&key), sizeof(key)));
+}
+
+DecodedTextureCache::DecodedTextureCache() = default;
+
+DecodedTextureCache::~DecodedTextureCache() {
+    Close();
+}
+
+void DecodedTextureCache::Open(u64 title_id) {
+    std::scoped_lock lock{mutex};
+    CloseLocked();
+
+    const auto base_dir{Common::FS::GetCitronPath(Common::FS::CitronPath::CacheDir) /
+                        "decoded_textures"};
+    if (!Common::FS::CreateDirs(base_dir)) {
+        LOG_ERROR(HW_GPU, "Failed to create decoded texture cache directory");
+        return;
+    }
+    const auto filename{base_dir / fmt::format("{:016x}.bin", title_id)};
+    if (!Common::FS::Exists(filename) && !CreatePack(filename)) {
+        LOG_ERROR(HW_GPU, "Failed to create decoded texture cache {}",
+                  Common::FS::PathToUTF8String(filename));
+        return;
+    }
+    if (!mapped.Open(filename)) {
+        return;
+    }
+    if (!IsValidPack(mapped.Data())) {
+        LOG_INFO(HW_GPU, "Decoded texture cache is outdated, recreating it");
+        mapped.Close();
+        if (!CreatePack(filename) || !mapped.Open(filename)) {
+            return;
+        }
+    }
+    const u64 valid_end = ScanRecords();
+    if (valid_end != mapped.Size()) {
+        // Drop the partially written record left behind by an interrupted session
+        LOG_WARNING(HW_GPU, "Decoded texture cache is truncated, dropping {} bytes",
+                    mapped.Size() - valid_end);
+        mapped.Close();
+        const Common::FS::IOFile truncate_file(filename, Common::FS::FileAccessMode::ReadWrite,
+                                               Common::FS::FileType::BinaryFile);
+        if (!truncate_file.IsOpen() || !truncate_file.SetSize(valid_end) ||
+            !mapped.Open(filename)) {
+            entries.clear();
+            return;
+        }
+    }
+
+    file.Open(filename, Common::FS::FileAccessMode::ReadAppend, Common::FS::FileType::BinaryFile);
+    if (!file.IsOpen()) {
+        mapped.Close();
+        entries.clear();
+        return;
+    }
+    file_end = valid_end;
+    is_open = true;
+    LOG_INFO(HW_GPU, "Loaded {} decoded textures ({} MiB)", entries.size(), file_end >> 20);
+}
+
+void DecodedTextureCache::Close() {
+    std::scoped_lock lock{mutex};
+    CloseLocked();
+}
+
+bool DecodedTextureCache::Contains(const DecodedTextureKey& key) {
+    std::scoped_lock lock{mutex};
+    const bool found = entries.contains(key);
+    if (!found) {
+        ++num_misses;
+    }
+    return found;
+}
+
+bool DecodedTextureCache::Load(const DecodedTextureKey& key, std::span<u8> output,
+                               Copies& copies) {
+    std::scoped_lock lock{mutex};
+    const auto it = entries.find(key);
+    if (it == entries.end()) {
+        ++num_misses;
+        return false;
+    }
+    const Entry& entry = it->second;
+    if (entry.data_size > output.size()) {
+        return false;
+    }
+    // Verify the record where it is stored, the output may be uncached staging memory
+    const u64 copies_size = entry.num_copies * sizeof(BufferImageCopy);
+    const u64 record_size = copies_size + entry.data_size;
+    const std::span<const u8> mapped_data = mapped.Data();
+    std::vector<u8> record_buffer;
+    std::span<const u8> record;
+    if (entry.offset + record_size <= mapped_data.size()) {
+        record = mapped_data.subspan(entry.offset, record_size);
+    } else {
+        record_buffer.resize(record_size);
+        if (!file.Seek(static_cast<s64>(entry.offset)) ||
+            file.ReadSpan(std::span(record_buffer)) != record_buffer.size()) {
+            return false;
+        }
+        record = record_buffer;
+    }
+    copies.resize(entry.num_copies);
+    std::memcpy(copies.data(), record.data(), copies_size);
+    const std::span<const u8> data = record.subspan(copies_size);
+    if (Checksum(std::span(copies.data(), copies.size()), data) != entry.checksum) {
+        LOG_ERROR(HW_GPU, "Decoded texture cache entry is damaged, dropping it");
+        entries.erase(it);
+        return false;
+    }
+    std::memcpy(output.data(), data.data(), data.size());
+    ++num_hits;
+    return true;
+}
+
+void DecodedTextureCache::Store(const DecodedTextureKey& key, std::span<const u8> data,
+                                std::span<const BufferImageCopy> copies) {
+    std::scoped_lock lock{mutex};
+    if (!is_open || entries.contains(key) || copies.empty() || copies.size() > MAX_COPIES) {
+        return;
+    }
+    const u64 record_size = sizeof(RecordHeader) + copies.size_bytes() + data.size();
+    if (file_end + record_size > MAX_PACK_SIZE) {
+        return;
+    }
+    const RecordHeader header{
+        .magic = RECORD_MAGIC,
+        .num_copies = static_cast<u32>(copies.size()),
+        .data_size = data.size(),
+        .checksum = Checksum(copies, data),
+        .key = key,
+    };
+    // Appending always writes at the end, the seek only switches the stream from reading
+    if (!file.Seek(0, Common::FS::SeekOrigin::End) || !file.WriteObject(header) ||
+        file.WriteSpan(copies) != copies.size() || file.WriteSpan(data) != data.size() ||
+        !file.Flush()) {
+        LOG_ERROR(HW_GPU, "Failed to write to the decoded texture cache, closing it");
+        CloseLocked();
+        return;
+    }
+    entries.emplace(key, Entry{
+                             .offset = file_end + sizeof(RecordHeader),
+                             .data_size = data.size(),
+                             .checksum = header.checksum,
+                             .num_copies = header.num_copies,
+                         });
+    file_end += record_size;
+    ++num_stored;
+}
+
+void DecodedTextureCache::CloseLocked() {
+    if (is_open) {
+        LOG_INFO(HW_GPU, "Decoded texture cache: {} hits, {} misses, {} stored", num_hits,
+                 num_misses, num_stored);
+    }
+    is_open = false;
+    file.Close();
+    mapped.Close();
+    entries.clear();
+    file_end = 0;
+    num_hits = 0;
+    num_misses = 0;
+    num_stored = 0;
+}
+
+u64 DecodedTextureCache::ScanRecords() {
+    entries.clear();
+    const std::span<const u8> data = mapped.Data();
+    u64 offset = sizeof(FileHeader);
+    while (const auto header = ReadRecordHeader(data, offset)) {
+        const u64 copies_size = header->num_copies * sizeof(BufferImageCopy);
+        entries.insert_or_assign(header->key, Entry{
+                                                  .offset = offset + sizeof(RecordHeader),
+                                                  .data_size = header->data_size,
+                                                  .checksum = header->checksum,
+                                                  .num_copies = header->num_copies,
+                                              });
+        offset += sizeof(RecordHeader) + copies_size + header->data_size;
+    }
+    return offset;
+}
+
+} // namespace VideoCommon
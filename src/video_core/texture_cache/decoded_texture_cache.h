@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright 2026 citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+#include "common/fs/file.h"
+#include "common/fs/mapped_file.h"
+#include "video_core/texture_cache/types.h"
+
+namespace VideoCommon {
+
+struct ImageInfo;
+
+/// Identifies the converted contents of an image.
+struct DecodedTextureKey {
+    u64 data_hash; ///< CityHash64 of the swizzled guest data
+    u32 format;
+    u32 type;
+    u32 width;
+    u32 height;
+    u32 depth;
+    u32 levels;
+    u32 layers;
+    u32 layout; ///< Pitch of linear images, packed block dimensions otherwise
+    u32 layer_stride;
+    u32 tile_width_spacing;
+    u32 target; ///< ASTC recompression mode the data was converted with
+    u32 reserved;
+
+    bool operator==(const DecodedTextureKey&) const = default;
+};
+static_assert(std::has_unique_object_representations_v<DecodedTextureKey>);
+
+/// Builds the key of an image from its guest data.
+[[nodiscard]] DecodedTextureKey MakeDecodedTextureKey(const ImageInfo& info,
+                                                      std::span<const u8> guest_data);
+
+/**
+ * Persistent cache of images converted on the CPU, such as decoded ASTC or BCn textures.
+ *
+ * Entries are appended to a per-title pack file that is memory mapped when it is opened, so hits
+ * are a copy from the page cache into the staging buffer. Entries stored during the session are
+ * read back from the file. Every entry is checksummed and damaged entries are dropped.
+ */
+class DecodedTextureCache {
+public:
+    using Copies = boost::container::small_vector<BufferImageCopy, 16>;
+
+    explicit DecodedTextureCache();
+    ~DecodedTextureCache();
+
+    DecodedTextureCache& operator=(const DecodedTextureCache&) = delete;
+    DecodedTextureCache(const DecodedTextureCache&) = delete;
+
+    /// Opens the pack file of the given title, creating it if it does not exist.
+    void Open(u64 title_id);
+
+    /// Closes the pack file.
+    void Close();
+
+    [[nodiscard]] bool IsOpen() const noexcept {
+        return is_open.load(std::memory_order_relaxed);
+    }
+
+    /// Returns true when the pack contains an entry for the key.
+    [[nodiscard]] bool Contains(const DecodedTextureKey& key);
+
+    /// Copies the entry for the key into output, returning the copies to upload it with.
+    /// Returns false when there is no valid entry that fits the output.
+    [[nodiscard]] bool Load(const DecodedTextureKey& key, std::span<u8> output, Copies& copies);
+
+    /// Appends an entry to the pack, unless it is already stored or the pack is full.
+    void Store(const DecodedTextureKey& key, std::span<const u8> data,
+               std::span<const BufferImageCopy> copies);
+
+private:
+    struct Entry {
+        u64 offset; ///< Offset of the copies, the data follows them
+        u64 data_size;
+        u64 checksum;
+        u32 num_copies;
+    };
+
+    struct KeyHash {
+        size_t operator()(const DecodedTextureKey& key) const noexcept;
+    };
+
+    void CloseLocked();
+
+    /// Scans the records of the mapped pack, returning the end of the last valid one.
+    u64 ScanRecords();
+
+    std::mutex mutex;
+    std::atomic_bool is_open{};
+    Common::FS::MappedFile mapped;
+    Common::FS::IOFile file;
+    std::unordered_map<DecodedTextureKey, Entry, KeyHash> entries;
+    u64 file_end{};
+    u64 num_hits{};
+    u64 num_misses{};
+    u64 num_stored{};
+};
+
+} // namespace VideoCommon
@@ -29,7 +29,9 @@ using namespace Common::Literals;
 
 template <class P>
 TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManager& device_memory_)
-    : runtime{runtime_}, device_memory{device_memory_} {
+    : runtime{runtime_}, device_memory{device_memory_},
+      use_predictive_downloads{Settings::values.use_predictive_downloads.GetValue() &&
+                               Settings::values.use_reactive_flushing.GetValue()} {
     // Configure null sampler
     TSCEntry sampler_descriptor{};
     sampler_descriptor.min_filter.Assign(Tegra::Texture::TextureFilter::Linear);
@@ -155,6 +157,9 @@ void TextureCache<P>::TickFrame() {
     sentenced_framebuffers.Tick();
     sentenced_image_view.Tick();
     TickAsyncDecode();
+    if (use_predictive_downloads) {
+        download_predictor.Tick(frame_tick);
+    }
 
     runtime.TickFrame();
     ++frame_tick;
@@ -167,6 +172,14 @@ void TextureCache<P>::TickFrame() {
     }
 }
 
+template <class P>
+void TextureCache<P>::LoadDiskResources(u64 title_id) {
+    if (title_id == 0 || !Settings::values.use_disk_texture_cache.GetValue()) {
+        return;
+    }
+    decoded_texture_cache.Open(title_id);
+}
+
 template <class P>
 const typename P::ImageView& TextureCache<P>::GetImageView(ImageViewId id) const noexcept {
     return slot_image_views[id];
@@ -592,6 +605,9 @@ std::optional<VideoCore::RasterizerDownloadArea> TextureCache<P>::GetFlushArea(D
         area->preemtive &= image.info.forced_flushed;
         image.info.forced_flushed = true;
     });
+    if (area && use_predictive_downloads) {
+        download_predictor.RecordRead(*area, frame_tick);
+    }
     return area;
 }
 
@@ -1076,6 +1092,19 @@ void TextureCache<P>::UploadImageContents(Image& image, StagingBuffer& staging)
     const GPUVAddr gpu_addr = image.gpu_addr;
 
     if (True(image.flags & ImageFlagBits::AcceleratedUpload)) {
+        if (decoded_texture_cache.IsOpen()) {
+            // A cached conversion skips the compute decode, but the staging buffer is sized for
+            // the guest data, so the converted contents need a buffer of their own
+            Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::UnsafeRead>
+                guest_data(*gpu_memory, gpu_addr, image.guest_size_bytes, &swizzle_data_buffer);
+            const DecodedTextureKey key = MakeDecodedTextureKey(image.info, guest_data);
+            if (decoded_texture_cache.Contains(key)) {
+                auto decoded_staging = runtime.UploadStagingBuffer(image.converted_size_bytes);
+                if (UploadDecodedTexture(image, key, decoded_staging)) {
+                    return;
+                }
+            }
+        }
         gpu_memory->ReadBlock(gpu_addr, mapped_span.data(), mapped_span.size_bytes(),
                               VideoCommon::CacheType::NoTextureCache);
         const auto uploads = FullUploadSwizzles(image.info);
@@ -1087,10 +1116,29 @@ void TextureCache<P>::UploadImageContents(Image& image, StagingBuffer& staging)
         *gpu_memory, gpu_addr, image.guest_size_bytes, &swizzle_data_buffer);
 
     if (True(image.flags & ImageFlagBits::Converted)) {
+        std::optional<DecodedTextureKey> cache_key;
+        if (decoded_texture_cache.IsOpen()) {
+            cache_key = MakeDecodedTextureKey(image.info, swizzle_data);
+            if (UploadDecodedTexture(image, *cache_key, staging)) {
+                return;
+            }
+        }
         unswizzle_data_buffer.resize_destructive(image.unswizzled_size_bytes);
         auto copies =
             UnswizzleImage(*gpu_memory, gpu_addr, image.info, swizzle_data, unswizzle_data_buffer);
-        ConvertImage(unswizzle_data_buffer, image.info, mapped_span, copies);
+        if (cache_key) {
+            // Convert into cached memory, so the contents can be stored without reading them back
+            // from the staging buffer
+            std::vector<u8> converted(mapped_span.size());
+            ConvertImage(unswizzle_data_buffer, image.info, converted, copies);
+            std::memcpy(mapped_span.data(), converted.data(), converted.size());
+            const BufferImageCopy& last_copy = copies.back();
+            converted.resize(last_copy.buffer_offset +
+                             ConvertedCopySizeBytes(image.info, last_copy));
+            QueueDecodedTextureStore(*cache_key, std::move(converted), copies);
+        } else {
+            ConvertImage(unswizzle_data_buffer, image.info, mapped_span, copies);
+        }
         image.UploadMemory(staging, copies);
     } else {
         const auto copies =
@@ -1099,6 +1147,28 @@ void TextureCache<P>::UploadImageContents(Image& image, StagingBuffer& staging)
     }
 }
 
+template <class P>
+template <typename StagingBuffer>
+bool TextureCache<P>::UploadDecodedTexture(Image& image, const DecodedTextureKey& key,
+                                           StagingBuffer& staging) {
+    DecodedTextureCache::Copies copies;
+    if (!decoded_texture_cache.Load(key, staging.mapped_span, copies)) {
+        return false;
+    }
+    image.UploadMemory(staging, copies);
+    return true;
+}
+
+template <class P>
+void TextureCache<P>::QueueDecodedTextureStore(const DecodedTextureKey& key, std::vector<u8> data,
+                                               std::span<const BufferImageCopy> copies) {
+    texture_decode_worker.QueueWork(
+        [this, key, data = std::move(data),
+         copies = DecodedTextureCache::Copies(copies.begin(), copies.end())] {
+            decoded_texture_cache.Store(key, data, copies);
+        });
+}
+
 template <class P>
 ImageViewId TextureCache<P>::FindImageView(const TICEntry& config) {
     if (!IsValidEntry(*gpu_memory, config)) {
@@ -1281,54 +1351,108 @@ void TextureCache<P>::QueueAsyncDecode(Image& image, ImageId image_id) {
     UNIMPLEMENTED_IF(False(image.flags & ImageFlagBits::Converted));
     LOG_INFO(HW_GPU, "Queuing async texture decode");
 
+    Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::UnsafeRead> swizzle_data(
+        *gpu_memory, image.gpu_addr, image.guest_size_bytes, &swizzle_data_buffer);
+    std::optional<DecodedTextureKey> cache_key;
+    if (decoded_texture_cache.IsOpen()) {
+        cache_key = MakeDecodedTextureKey(image.info, swizzle_data);
+        if (decoded_texture_cache.Contains(*cache_key)) {
+            auto staging = runtime.UploadStagingBuffer(MapSizeBytes(image));
+            if (UploadDecodedTexture(image, *cache_key, staging)) {
+                runtime.InsertUploadMemoryBarrier();
+                return;
+            }
+        }
+    }
+
     image.flags |= ImageFlagBits::IsDecoding;
-    auto decode = std::make_unique<AsyncDecodeContext>();
-    auto* decode_ptr = decode.get();
+    auto decode = std::make_unique<AsyncDecodeContext<AsyncBuffer>>();
+    auto* const decode_ptr = decode.get();
     decode->image_id = image_id;
-    async_decodes.push_back(std::move(decode));
+    decode->staging = runtime.UploadStagingBuffer(MapSizeBytes(image), true);
+    decode->unswizzled_data.resize_destructive(image.unswizzled_size_bytes);
+    decode->cache_key = cache_key;
+    if (cache_key) {
+        decode->converted.resize(MapSizeBytes(image));
+    }
 
-    static Common::ScratchBuffer<u8> local_unswizzle_data_buffer;
-    local_unswizzle_data_buffer.resize_destructive(image.unswizzled_size_bytes);
-    Tegra::Memory::GpuGuestMemory<u8, Tegra::Memory::GuestMemoryFlags::UnsafeRead> swizzle_data(
-        *gpu_memory, image.gpu_addr, image.guest_size_bytes, &swizzle_data_buffer);
+    const auto copies = UnswizzleImage(*gpu_memory, image.gpu_addr, image.info, swizzle_data,
+                                       decode->unswizzled_data);
 
-    auto copies = UnswizzleImage(*gpu_memory, image.gpu_addr, image.info, swizzle_data,
-                                 local_unswizzle_data_buffer);
-    const size_t out_size = MapSizeBytes(image);
-
-    auto func = [out_size, copies, info = image.info,
-                 input = std::move(local_unswizzle_data_buffer),
-                 async_decode = decode_ptr]() mutable {
-        async_decode->decoded_data.resize_destructive(out_size);
-        std::span copies_span{copies.data(), copies.size()};
-        ConvertImage(input, info, async_decode->decoded_data, copies_span);
-
-        // TODO: Do we need this lock?
-        std::unique_lock lock{async_decode->mutex};
-        async_decode->copies = std::move(copies);
-        async_decode->complete = true;
-    };
-    texture_decode_worker.QueueWork(std::move(func));
+    decode->num_levels = copies.size();
+    decode->levels = std::make_unique<AsyncDecodeLevel[]>(copies.size());
+    async_decodes.push_back(std::move(decode));
+
+    // Each level is decoded straight into its place in the staging buffer, so it can be uploaded
+    // while the next ones are still being decoded. Levels that are going to be stored in the
+    // decoded texture cache are converted into cached memory first, and the last level stores
+    // the whole image once every level is done, as the worker runs the jobs in order.
+    const std::span<u8> staging_span = decode_ptr->staging.mapped_span;
+    u32 output_offset = 0;
+    for (size_t index = 0; index < copies.size(); ++index) {
+        const u32 output_size = ConvertedCopySizeBytes(image.info, copies[index]);
+        const bool is_last = index + 1 == copies.size();
+        auto func = [this, info = image.info, copy = copies[index], output_offset, output_size,
+                     staging_span, async_decode = decode_ptr, index, is_last]() mutable {
+            if (async_decode->cache_key) {
+                const std::span<u8> output =
+                    std::span(async_decode->converted).subspan(output_offset, output_size);
+                ConvertImage(async_decode->unswizzled_data, info, output, std::span(&copy, 1));
+                std::memcpy(staging_span.data() + output_offset, output.data(), output_size);
+            } else {
+                ConvertImage(async_decode->unswizzled_data, info,
+                             staging_span.subspan(output_offset, output_size),
+                             std::span(&copy, 1));
+            }
+            copy.buffer_offset += output_offset;
+
+            AsyncDecodeLevel& level = async_decode->levels[index];
+            level.copy = copy;
+            if (is_last && async_decode->cache_key) {
+                DecodedTextureCache::Copies level_copies;
+                for (size_t i = 0; i <= index; ++i) {
+                    level_copies.push_back(async_decode->levels[i].copy);
+                }
+                decoded_texture_cache.Store(
+                    *async_decode->cache_key,
+                    std::span(async_decode->converted).first(output_offset + output_size),
+                    level_copies);
+            }
+            level.complete.store(true, std::memory_order_release);
+        };
+        texture_decode_worker.QueueWork(std::move(func));
+        output_offset += output_size;
+    }
 }
 
 template <class P>
 void TextureCache<P>::TickAsyncDecode() {
     bool has_uploads{};
+    boost::container::small_vector<BufferImageCopy, 16> ready_copies;
     auto i = async_decodes.begin();
     while (i != async_decodes.end()) {
         auto* async_decode = i->get();
-        std::unique_lock lock{async_decode->mutex};
-        if (!async_decode->complete) {
+        ready_copies.clear();
+        for (size_t index = 0; index < async_decode->num_levels; ++index) {
+            AsyncDecodeLevel& level = async_decode->levels[index];
+            if (level.uploaded || !level.complete.load(std::memory_order_acquire)) {
+                continue;
+            }
+            ready_copies.push_back(level.copy);
+            level.uploaded = true;
+            ++async_decode->num_uploaded;
+        }
+        Image& image = slot_images[async_decode->image_id];
+        if (!ready_copies.empty()) {
+            image.UploadMemory(async_decode->staging, ready_copies);
+            has_uploads = true;
+        }
+        if (async_decode->num_uploaded != async_decode->num_levels) {
             ++i;
             continue;
         }
-        Image& image = slot_images[async_decode->image_id];
-        auto staging = runtime.UploadStagingBuffer(MapSizeBytes(image));
-        std::memcpy(staging.mapped_span.data(), async_decode->decoded_data.data(),
-                    async_decode->decoded_data.size());
-        image.UploadMemory(staging, async_decode->copies);
         image.flags &= ~ImageFlagBits::IsDecoding;
-        has_uploads = true;
+        runtime.FreeDeferredUploadStagingBuffer(async_decode->staging);
         i = async_decodes.erase(i);
     }
     if (has_uploads) {
@@ -1999,6 +2123,11 @@ void TextureCache<P>::RegisterImage(ImageId image_id) {
     }
     total_used_memory += Common::AlignUp(tentative_size, 1024);
     image.lru_index = lru_cache.Insert(image_id, frame_tick);
+    if (use_predictive_downloads &&
+        download_predictor.IsPredicted(image.cpu_addr, image.guest_size_bytes)) {
+        // Images recreated over memory the CPU keeps reading back are downloaded preemptively
+        image.info.forced_flushed = true;
+    }
 
     ForEachGPUPage(image.gpu_addr, image.guest_size_bytes, [this, image_id](u64 page) {
         (*channel_state->gpu_page_table)[page].push_back(image_id);
@@ -2469,8 +2598,19 @@ void TextureCache<P>::BindRenderTarget(ImageViewId* old_id, ImageViewId new_id)
     if (new_id) {
         const ImageViewBase& old_view = slot_image_views[new_id];
         if (True(old_view.flags & ImageViewFlagBits::PreemtiveDownload)) {
-            const PendingDownload new_download{true, 0, old_view.image_id};
-            uncommitted_downloads.emplace_back(new_download);
+            ImageBase& image = slot_images[old_view.image_id];
+            if (use_predictive_downloads &&
+                !download_predictor.IsPredicted(image.cpu_addr, image.guest_size_bytes)) {
+                // The CPU stopped reading the image back, stop downloading it
+                image.info.forced_flushed = false;
+                for (const ImageViewId image_view_id : image.image_view_ids) {
+                    slot_image_views[image_view_id].flags &=
+                        ~ImageViewFlagBits::PreemtiveDownload;
+                }
+            } else {
+                const PendingDownload new_download{true, 0, old_view.image_id};
+                uncommitted_downloads.emplace_back(new_download);
+            }
         }
     }
     *old_id = new_id;
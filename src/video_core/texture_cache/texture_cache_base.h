@@ -7,6 +7,7 @@
 #include <deque>
 #include <limits>
 #include <mutex>
+#include <optional>
 #include <span>
 #include <type_traits>
 #include <unordered_map>
@@ -26,8 +27,10 @@
 #include "video_core/compatible_formats.h"
 #include "video_core/control/channel_state_cache.h"
 #include "video_core/delayed_destruction_ring.h"
+#include "video_core/download_predictor.h"
 #include "video_core/engines/fermi_2d.h"
 #include "video_core/surface.h"
+#include "video_core/texture_cache/decoded_texture_cache.h"
 #include "video_core/texture_cache/descriptor_table.h"
 #include "video_core/texture_cache/image_base.h"
 #include "video_core/texture_cache/image_info.h"
@@ -55,12 +58,25 @@ struct ImageViewInOut {
     ImageViewId id{};
 };
 
+/// One mip level of an asynchronously decoded image.
+struct AsyncDecodeLevel {
+    BufferImageCopy copy;
+    std::atomic_bool complete;
+    bool uploaded;
+};
+
+/// Image decoded level by level into deferred staging memory. Levels are uploaded as soon as
+/// they are decoded, while the following levels are still being decoded.
+template <typename StagingBuffer>
 struct AsyncDecodeContext {
     ImageId image_id;
-    Common::ScratchBuffer<u8> decoded_data;
-    boost::container::small_vector<BufferImageCopy, 16> copies;
-    std::mutex mutex;
-    std::atomic_bool complete;
+    StagingBuffer staging;
+    Common::ScratchBuffer<u8> unswizzled_data;
+    std::optional<DecodedTextureKey> cache_key;
+    std::vector<u8> converted; ///< Contents to store in the decoded texture cache
+    std::unique_ptr<AsyncDecodeLevel[]> levels;
+    size_t num_levels;
+    size_t num_uploaded;
 };
 
 using TextureCacheGPUMap = std::unordered_map<u64, std::vector<ImageId>, Common::IdentityHash<u64>>;
@@ -134,6 +150,9 @@ public:
     /// Notify the cache that a new frame has been queued
     void TickFrame();
 
+    /// Open the decoded texture cache of the given title
+    void LoadDiskResources(u64 title_id);
+
     /// Return a constant reference to the given image view id
     [[nodiscard]] const ImageView& GetImageView(ImageViewId id) const noexcept;
 
@@ -309,6 +328,15 @@ private:
     template <typename StagingBuffer>
     void UploadImageContents(Image& image, StagingBuffer& staging_buffer);
 
+    /// Upload the converted contents of an image from the decoded texture cache
+    template <typename StagingBuffer>
+    bool UploadDecodedTexture(Image& image, const DecodedTextureKey& key,
+                              StagingBuffer& staging_buffer);
+
+    /// Store converted image contents in the decoded texture cache on the decode worker
+    void QueueDecodedTextureStore(const DecodedTextureKey& key, std::vector<u8> data,
+                                  std::span<const BufferImageCopy> copies);
+
     /// Find or create an image view from a guest descriptor
     [[nodiscard]] ImageViewId FindImageView(const TICEntry& config);
 
@@ -489,8 +517,12 @@ private:
     u64 modification_tick = 0;
     u64 frame_tick = 0;
 
+    DownloadPredictor download_predictor;
+    bool use_predictive_downloads = false;
+
+    DecodedTextureCache decoded_texture_cache;
+    std::vector<std::unique_ptr<AsyncDecodeContext<AsyncBuffer>>> async_decodes;
     Common::ThreadWorker texture_decode_worker{1, "TextureDecoder"};
-    std::vector<std::unique_ptr<AsyncDecodeContext>> async_decodes;
 
     // Join caching
     boost::container::small_vector<ImageId, 4> join_overlap_ids;
@@ -910,6 +910,25 @@ boost::container::small_vector<BufferImageCopy, 16> UnswizzleImage(Tegra::Memory
     return copies;
 }
 
+u32 ConvertedCopySizeBytes(const ImageInfo& info, const BufferImageCopy& copy) {
+    const u32 num_layers = copy.image_subresource.num_layers;
+    if (!IsPixelFormatASTC(info.format)) {
+        return copy.image_extent.width * copy.image_extent.height * num_layers *
+               ConvertedBytesPerBlock(info.format);
+    }
+    const auto recompression_setting = Settings::values.astc_recompression.GetValue();
+    if (recompression_setting == Settings::AstcRecompression::Uncompressed) {
+        return copy.image_extent.width * copy.image_extent.height * num_layers *
+               BytesPerBlock(PixelFormat::A8B8G8R8_UNORM);
+    }
+    // BC1 uses 0.5 bytes per texel
+    // BC3 uses 1 byte per texel
+    const u32 bpp_div = recompression_setting == Settings::AstcRecompression::Bc1 ? 2 : 1;
+    const u32 aligned_plane_dim =
+        Common::AlignUp(copy.image_extent.width, 4) * Common::AlignUp(copy.image_extent.height, 4);
+    return (aligned_plane_dim * copy.image_extent.depth * num_layers) / bpp_div;
+}
+
 void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8> output,
                   std::span<BufferImageCopy> copies) {
     u32 output_offset = 0;
@@ -936,17 +955,10 @@ void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8
                 input_offset, copy.image_extent.width, copy.image_extent.height,
                 copy.image_subresource.num_layers * copy.image_extent.depth, tile_size.width,
                 tile_size.height, output.subspan(output_offset));
-
-            output_offset += copy.image_extent.width * copy.image_extent.height *
-                             copy.image_subresource.num_layers *
-                             BytesPerBlock(PixelFormat::A8B8G8R8_UNORM);
         } else if (astc) {
-            // BC1 uses 0.5 bytes per texel
-            // BC3 uses 1 byte per texel
             const auto compress = recompression_setting == Settings::AstcRecompression::Bc1
                                       ? Tegra::Texture::BCN::CompressBC1
                                       : Tegra::Texture::BCN::CompressBC3;
-            const auto bpp_div = recompression_setting == Settings::AstcRecompression::Bc1 ? 2 : 1;
 
             const u32 plane_dim = copy.image_extent.width * copy.image_extent.height;
             const u32 level_size = plane_dim * copy.image_extent.depth *
@@ -963,19 +975,11 @@ void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8
                      copy.image_subresource.num_layers * copy.image_extent.depth,
                      output.subspan(output_offset));
 
-            const u32 aligned_plane_dim = Common::AlignUp(copy.image_extent.width, 4) *
-                                          Common::AlignUp(copy.image_extent.height, 4);
-
-            copy.buffer_size =
-                (aligned_plane_dim * copy.image_extent.depth * copy.image_subresource.num_layers) /
-                bpp_div;
-            output_offset += static_cast<u32>(copy.buffer_size);
+            copy.buffer_size = ConvertedCopySizeBytes(info, copy);
         } else {
             DecompressBCn(input_offset, output.subspan(output_offset), copy, info.format);
-            output_offset += copy.image_extent.width * copy.image_extent.height *
-                             copy.image_subresource.num_layers *
-                             ConvertedBytesPerBlock(info.format);
         }
+        output_offset += ConvertedCopySizeBytes(info, copy);
 
         copy.buffer_row_length = mip_size.width;
         copy.buffer_image_height = mip_size.height;
@@ -66,6 +66,9 @@ struct OverlapResult {
     Tegra::MemoryManager& gpu_memory, GPUVAddr gpu_addr, const ImageInfo& info,
     std::span<const u8> input, std::span<u8> output);
 
+/// Returns the number of bytes ConvertImage writes for the given copy.
+[[nodiscard]] u32 ConvertedCopySizeBytes(const ImageInfo& info, const BufferImageCopy& copy);
+
 void ConvertImage(std::span<const u8> input, const ImageInfo& info, std::span<u8> output,
                   std::span<BufferImageCopy> copies);
 
@@ -3,6 +3,8 @@
 
 #include <memory>
 
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
 #include "core/core.h"
@@ -10,8 +12,10 @@
 #include "video_core/host1x/host1x.h"
 #include "video_core/renderer_base.h"
 #include "video_core/renderer_null/renderer_null.h"
+#include "video_core/renderer_opengl/gl_shader_cache.h"
 #include "video_core/renderer_opengl/renderer_opengl.h"
 #include "video_core/renderer_vulkan/renderer_vulkan.h"
+#include "video_core/renderer_vulkan/vk_pipeline_cache.h"
 #include "video_core/video_core.h"
 
 namespace {
@@ -60,4 +64,23 @@ std::unique_ptr<Tegra::GPU> CreateGPU(Core::Frontend::EmuWindow& emu_window, Cor
     }
 }
 
+size_t MigratePipelineCaches() {
+    const auto shader_dir{Common::FS::GetCitronPath(Common::FS::CitronPath::ShaderDir)};
+    size_t num_migrated{};
+    const auto migrate{[&](const std::filesystem::path& filename, auto&& migrate_file) {
+        if (Common::FS::Exists(filename) && migrate_file(filename)) {
+            ++num_migrated;
+        }
+    }};
+    Common::FS::IterateDirEntries(
+        shader_dir,
+        [&](const std::filesystem::directory_entry& entry) {
+            migrate(entry.path() / "vulkan.bin", &Vulkan::PipelineCache::MigrateDiskCache);
+            migrate(entry.path() / "opengl.bin", &OpenGL::ShaderCache::MigrateDiskCache);
+            return true;
+        },
+        Common::FS::DirEntryFilter::Directory);
+    return num_migrated;
+}
+
 } // namespace VideoCore
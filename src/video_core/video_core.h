@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 namespace Core {
@@ -24,4 +25,8 @@ class RendererBase;
 /// Creates an emulated GPU instance using the given system context.
 std::unique_ptr<Tegra::GPU> CreateGPU(Core::Frontend::EmuWindow& emu_window, Core::System& system);
 
+/// Converts every legacy transferable pipeline cache in the shader directory to the current
+/// container format. Returns the number of caches that were converted.
+size_t MigratePipelineCaches();
+
 } // namespace VideoCore